@@ -0,0 +1,771 @@
+// Набор бенчмарков: myvector, slist, dlist, rawdlist, ulist и ilist против
+// std::vector, std::forward_list и std::list на int, std::string и большой POD-структуре;
+// mpsc_queue против slist под общим мьютексом; параллельные reduce/sort из parallel.h;
+// буферизованный write_to против operator<< на каждый элемент; проход по одному
+// полю в soa_vector против myvector широких записей; векторные index_of/min_max
+// против скалярного цикла; очередь на ring_buffer против myvector с erase(0);
+// снимок cow_myvector против копии; сортировка списков перешиванием узлов;
+// временные контейнеры запроса в std::pmr::monotonic_buffer_resource;
+// добавление из многих потоков в concurrent_myvector против myvector под мьютексом;
+// короткоживущие static_myvector и static_slist без кучи; загрузка двоичного
+// файла в myvector (load_binary) против отображения (mapped_myvector).
+//
+// Машиночитаемый результат:
+//     lab3_bench --benchmark_out=bench.json --benchmark_out_format=json
+// (или цель bench_json в CMake). Два таких файла сравниваются скриптом
+// tools/compare.py из Google Benchmark.
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdio>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <memory_resource>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "myvector.h"
+#include "slist.h"
+#include "dlist.h"
+#include "rawdlist.h"
+#include "ulist.h"
+#include "ilist.h"
+#include "mpsc_queue.h"
+#include "parallel.h"
+#include "soa_vector.h"
+#include "ring_buffer.h"
+#include "cow_myvector.h"
+#include "concurrent_myvector.h"
+#include "static_myvector.h"
+#include "static_slist.h"
+#include "serialize.h"
+
+namespace
+{
+    // "Большой" POD: 128 байт, копируется только целиком
+    struct LargePod
+    {
+        std::array<std::uint64_t, 16> words;
+    };
+
+    // Значение номер i для каждого типа.
+    // Строки длиннее буфера SSO, чтобы каждая копия действительно выделяла память.
+    template <typename T>
+    T make_value(int i);
+
+    template <>
+    int make_value<int>(int i)
+    {
+        return i;
+    }
+
+    template <>
+    std::string make_value<std::string>(int i)
+    {
+        return "benchmark-value-" + std::to_string(i);
+    }
+
+    template <>
+    LargePod make_value<LargePod>(int i)
+    {
+        LargePod pod{};
+        pod.words.fill(static_cast<std::uint64_t>(i));
+        return pod;
+    }
+
+    // Числовая "выжимка" элемента, чтобы компилятор не выбросил обход
+    std::uint64_t weight(int value) { return static_cast<std::uint64_t>(value); }
+    std::uint64_t weight(const std::string &value) { return value.size(); }
+    std::uint64_t weight(const LargePod &value) { return value.words[0]; }
+
+    // Наибольший размер для типа: 10M строк или больших структур (10M узлов по
+    // 128+ байт) не помещаются в память обычной машины сборки
+    template <typename T>
+    constexpr int max_size = 1000000;
+    template <>
+    constexpr int max_size<int> = 10000000;
+
+    template <typename T>
+    void sizes(benchmark::internal::Benchmark *bench)
+    {
+        for (int n = 10; n <= max_size<T>; n *= 10)
+            bench->Arg(n);
+    }
+
+    // Единый интерфейс к нашим контейнерам и к эталонам из STL.
+    // Наши контейнеры работают через индексы, STL - через итераторы.
+    template <typename C>
+    void push_back(C &c, typename C::value_type &&value) { c.push_back(std::move(value)); }
+
+    template <typename C>
+    void insert_at(C &c, int position, typename C::value_type &&value) { c.insert(std::move(value), position); }
+
+    template <typename C>
+    void erase_at(C &c, int position) { c.erase(position); }
+
+    template <typename C>
+    typename C::value_type &index(C &c, int i) { return c[i]; }
+
+    template <typename T>
+    void insert_at(std::vector<T> &c, int position, T &&value) { c.insert(c.begin() + position, std::move(value)); }
+
+    template <typename T>
+    void erase_at(std::vector<T> &c, int position) { c.erase(c.begin() + position); }
+
+    template <typename T>
+    void insert_at(std::list<T> &c, int position, T &&value) { c.insert(std::next(c.begin(), position), std::move(value)); }
+
+    template <typename T>
+    void erase_at(std::list<T> &c, int position) { c.erase(std::next(c.begin(), position)); }
+
+    template <typename T>
+    T &index(std::list<T> &c, int i) { return *std::next(c.begin(), i); }
+
+    template <typename T>
+    void insert_at(std::forward_list<T> &c, int position, T &&value)
+    {
+        c.insert_after(std::next(c.before_begin(), position), std::move(value));
+    }
+
+    template <typename T>
+    void erase_at(std::forward_list<T> &c, int position) { c.erase_after(std::next(c.before_begin(), position)); }
+
+    template <typename T>
+    T &index(std::forward_list<T> &c, int i) { return *std::next(c.begin(), i); }
+
+    // Дешёвая (O(1)) вставка для восстановления размера после удаления:
+    // в конец, а у forward_list (без хвоста) - в начало
+    template <typename C>
+    void refill(C &c, typename C::value_type &&value) { push_back(c, std::move(value)); }
+
+    template <typename T>
+    void refill(std::forward_list<T> &c, T &&value) { c.push_front(std::move(value)); }
+
+    // Контейнер из n элементов. У forward_list нет push_back, поэтому он
+    // заполняется через итератор на последний узел
+    template <typename C>
+    C build(int n)
+    {
+        using T = typename C::value_type;
+        C c;
+        for (int i = 0; i < n; ++i)
+            push_back(c, make_value<T>(i));
+        return c;
+    }
+
+    template <typename T>
+    std::forward_list<T> build_forward(int n)
+    {
+        std::forward_list<T> c;
+        auto last = c.before_begin();
+        for (int i = 0; i < n; ++i)
+            last = c.insert_after(last, make_value<T>(i));
+        return c;
+    }
+
+    template <typename C>
+    struct builder
+    {
+        static C make(int n) { return build<C>(n); }
+    };
+
+    template <typename T>
+    struct builder<std::forward_list<T>>
+    {
+        static std::forward_list<T> make(int n) { return build_forward<T>(n); }
+    };
+
+    // Позиции вставки/удаления
+    enum class Where
+    {
+        Front,
+        Middle,
+        Back
+    };
+
+    int position(Where where, int n)
+    {
+        switch (where)
+        {
+        case Where::Front:
+            return 0;
+        case Where::Middle:
+            return n / 2;
+        default:
+            return n;
+        }
+    }
+
+    // Заполнение пустого контейнера n вставками в конец
+    template <typename C>
+    void BM_PushBack(benchmark::State &state)
+    {
+        const int n = static_cast<int>(state.range(0));
+        for (auto _ : state)
+        {
+            C c = builder<C>::make(n);
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // Вставка в позицию и удаление оттуда же: размер контейнера не меняется
+    template <typename C, Where where>
+    void BM_Insert(benchmark::State &state)
+    {
+        using T = typename C::value_type;
+        const int n = static_cast<int>(state.range(0));
+        C c = builder<C>::make(n);
+        const int pos = position(where, n);
+        for (auto _ : state)
+        {
+            insert_at(c, pos, make_value<T>(-1));
+            erase_at(c, pos);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Удаление из середины; размер восстанавливается дешёвой вставкой (см. refill)
+    template <typename C>
+    void BM_Erase(benchmark::State &state)
+    {
+        using T = typename C::value_type;
+        const int n = static_cast<int>(state.range(0));
+        C c = builder<C>::make(n);
+        for (auto _ : state)
+        {
+            erase_at(c, n / 2);
+            refill(c, make_value<T>(-1));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Доступ по индексу к "случайным" позициям
+    template <typename C>
+    void BM_Index(benchmark::State &state)
+    {
+        const int n = static_cast<int>(state.range(0));
+        C c = builder<C>::make(n);
+        std::int64_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(weight(index(c, static_cast<int>(i))));
+            i = (i + 7919) % n;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Много короткоживущих контейнеров по n элементов: проверка small_myvector,
+    // которому при n <= N куча не нужна вовсе, и static_myvector/static_slist,
+    // которым куча не нужна никогда
+    template <typename C>
+    void BM_ShortLived(benchmark::State &state)
+    {
+        const int n = static_cast<int>(state.range(0));
+        for (auto _ : state)
+        {
+            C c;
+            for (int i = 0; i < n; ++i)
+                push_back(c, make_value<int>(i));
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Полный обход итераторами
+    template <typename C>
+    void BM_Iterate(benchmark::State &state)
+    {
+        const int n = static_cast<int>(state.range(0));
+        C c = builder<C>::make(n);
+        for (auto _ : state)
+        {
+            std::uint64_t sum = 0;
+            for (auto it = c.begin(); it != c.end(); ++it)
+                sum += weight(*it);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // Рабочая очередь по-старому: slist под одним мьютексом на всех производителей
+    class locked_slist_queue
+    {
+        std::mutex mutex;
+        slist<int> items;
+
+    public:
+        void push(int value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            items.push_back(value);
+        }
+
+        template <typename Sink>
+        std::size_t drain(Sink &&sink)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::size_t count = items.size();
+            while (!items.empty())
+            {
+                sink(items.front());
+                items.pop_front();
+            }
+            return count;
+        }
+    };
+
+    // Общий вектор по-старому: myvector под одним мьютексом на всех писателей
+    class locked_myvector
+    {
+        std::mutex mutex;
+        myvector<int> items;
+
+    public:
+        std::size_t push_back(int value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            items.push_back(value);
+            return items.size() - 1;
+        }
+    };
+
+    // range(0) потоков добавляют по 100000 элементов в общий вектор
+    template <typename V>
+    void BM_ConcurrentAppend(benchmark::State &state)
+    {
+        const int writers = static_cast<int>(state.range(0));
+        const int perWriter = 100000;
+        for (auto _ : state)
+        {
+            V vect;
+            std::vector<std::thread> threads;
+            for (int w = 0; w < writers; ++w)
+                threads.emplace_back([&vect, perWriter] {
+                    std::size_t last = 0;
+                    for (int i = 0; i < perWriter; ++i)
+                        last = vect.push_back(i);
+                    benchmark::DoNotOptimize(last);
+                });
+            for (std::thread &thread : threads)
+                thread.join();
+        }
+        state.SetItemsProcessed(state.iterations() * writers * perWriter);
+    }
+
+    // range(0) производителей кладут по 10000 элементов, текущий поток забирает их пакетами
+    template <typename Q>
+    void BM_WorkQueue(benchmark::State &state)
+    {
+        const int producers = static_cast<int>(state.range(0));
+        const int perProducer = 10000;
+        for (auto _ : state)
+        {
+            Q queue;
+            std::vector<std::thread> threads;
+            for (int p = 0; p < producers; ++p)
+                threads.emplace_back([&queue, perProducer] {
+                    for (int i = 0; i < perProducer; ++i)
+                        queue.push(i);
+                });
+
+            std::uint64_t sum = 0;
+            std::size_t received = 0;
+            while (received < static_cast<std::size_t>(producers) * perProducer)
+                received += queue.drain([&sum](int value) { sum += value; });
+            for (std::thread &thread : threads)
+                thread.join();
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * producers * perProducer);
+    }
+
+    // Свёртка 4M double: последовательно (grain больше массива) и по потокам
+    void BM_Reduce(benchmark::State &state)
+    {
+        const std::size_t n = std::size_t(1) << 22;
+        const std::size_t grain = state.range(0) ? parallel_grain : n + 1;
+        myvector<double> v;
+        for (std::size_t i = 0; i < n; ++i)
+            v.push_back(static_cast<double>(i % 1000));
+        for (auto _ : state)
+            benchmark::DoNotOptimize(parallel_reduce(v, 0.0, std::plus<>(), grain));
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // Сортировка 1M int в случайном порядке: последовательно и по потокам
+    void BM_Sort(benchmark::State &state)
+    {
+        const std::size_t n = std::size_t(1) << 20;
+        const std::size_t grain = state.range(0) ? parallel_grain : n + 1;
+        myvector<int> v;
+        for (std::size_t i = 0; i < n; ++i)
+            v.push_back(static_cast<int>((i * 2654435761u) % n));
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            myvector<int> work(v.begin(), v.end());
+            state.ResumeTiming();
+            parallel_sort(work, std::less<>(), grain);
+            benchmark::DoNotOptimize(work.data());
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // Текстовый вывод 1M int в строковый поток: по элементу через operator<<
+    // (как print() раньше) или блоками через write_to
+    void BM_WriteText(benchmark::State &state)
+    {
+        const std::size_t n = std::size_t(1) << 20;
+        myvector<int> v;
+        for (std::size_t i = 0; i < n; ++i)
+            v.push_back(static_cast<int>(i * 2654435761u));
+        for (auto _ : state)
+        {
+            std::ostringstream out;
+            if (state.range(0))
+            {
+                v.write_to(out);
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    out << v[i] << ' ';
+            }
+            benchmark::DoNotOptimize(out.tellp());
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // Файл из 16M int (64 МБ), записанный save_binary, и сумма всех элементов:
+    // 0 - load_binary в myvector, 1 - mapped_myvector (страницы из кэша файлов)
+    void BM_LoadBinary(benchmark::State &state)
+    {
+        const std::size_t n = std::size_t(1) << 24;
+        const char *path = "lab3_bench_vector.bin";
+        {
+            myvector<int> v;
+            v.reserve(n);
+            for (std::size_t i = 0; i < n; ++i)
+                v.push_back(static_cast<int>(i));
+            save_binary(v, path);
+        }
+        for (auto _ : state)
+        {
+            std::uint64_t sum = 0;
+            if (state.range(0) == 1)
+            {
+                mapped_myvector<int> mapped(path);
+                for (int value : mapped)
+                    sum += static_cast<std::uint64_t>(value);
+            }
+            else
+            {
+                myvector<int> loaded;
+                load_binary(loaded, path);
+                for (int value : loaded)
+                    sum += static_cast<std::uint64_t>(value);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        std::remove(path);
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(n * sizeof(int)));
+    }
+
+    // Широкая запись: проход по одному полю тянет через кэш все 64 байта
+    struct Record
+    {
+        std::uint64_t id;
+        double price;
+        std::array<std::uint64_t, 6> payload;
+    };
+
+    constexpr std::size_t scanRows = std::size_t(1) << 20;
+
+    // Сумма поля price: массив записей
+    void BM_ScanRecords(benchmark::State &state)
+    {
+        myvector<Record> rows;
+        for (std::size_t i = 0; i < scanRows; ++i)
+            rows.push_back(Record{i, static_cast<double>(i % 100), {}});
+        for (auto _ : state)
+        {
+            double sum = 0;
+            for (const Record &row : rows)
+                sum += row.price;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * scanRows);
+    }
+
+    // То же поле отдельным столбцом soa_vector
+    void BM_ScanColumn(benchmark::State &state)
+    {
+        soa_vector<std::uint64_t, double, std::array<std::uint64_t, 6>> rows;
+        for (std::size_t i = 0; i < scanRows; ++i)
+            rows.emplace_back(i, static_cast<double>(i % 100), std::array<std::uint64_t, 6>{});
+        for (auto _ : state)
+        {
+            double sum = 0;
+            for (double price : rows.column<1>())
+                sum += price;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * scanRows);
+    }
+
+    constexpr std::size_t searchCount = std::size_t(1) << 20;
+
+    // Поиск отсутствующего значения (проход по всему массиву):
+    // 0 - цикл через operator[], 1 - index_of (векторные ядра)
+    template <typename T>
+    void BM_Search(benchmark::State &state)
+    {
+        aligned_myvector<T> v;
+        for (std::size_t i = 0; i < searchCount; ++i)
+            v.push_back(static_cast<T>(i % 1000));
+        const T missing = static_cast<T>(-1);
+        for (auto _ : state)
+        {
+            std::size_t found = v.npos;
+            if (state.range(0) == 1)
+            {
+                found = v.index_of(missing);
+            }
+            else
+            {
+                for (std::size_t i = 0; i < v.size(); ++i)
+                {
+                    if (v[i] == missing)
+                    {
+                        found = i;
+                        break;
+                    }
+                }
+            }
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * searchCount);
+    }
+
+    // Наименьший и наибольший элементы: 0 - цикл через operator[], 1 - min_max
+    template <typename T>
+    void BM_MinMax(benchmark::State &state)
+    {
+        aligned_myvector<T> v;
+        for (std::size_t i = 0; i < searchCount; ++i)
+            v.push_back(static_cast<T>((i * 7919) % 100003));
+        for (auto _ : state)
+        {
+            std::pair<T, T> range;
+            if (state.range(0) == 1)
+            {
+                range = v.min_max();
+            }
+            else
+            {
+                range = {v[0], v[0]};
+                for (std::size_t i = 1; i < v.size(); ++i)
+                {
+                    range.first = std::min(range.first, v[i]);
+                    range.second = std::max(range.second, v[i]);
+                }
+            }
+            benchmark::DoNotOptimize(range);
+        }
+        state.SetItemsProcessed(state.iterations() * searchCount);
+    }
+
+    // Снятие элемента с начала очереди
+    void pop_oldest(myvector<int> &queue) { queue.erase(0); }
+    void pop_oldest(ring_buffer<int> &queue) { queue.pop_front(); }
+    void pop_oldest(std::deque<int> &queue) { queue.pop_front(); }
+
+    // Очередь FIFO постоянной длины state.range(0): в конец добавляется элемент, с начала снимается
+    template <typename Queue>
+    void BM_Fifo(benchmark::State &state)
+    {
+        const std::size_t n = static_cast<std::size_t>(state.range(0));
+        Queue queue;
+        for (std::size_t i = 0; i < n; ++i)
+            queue.push_back(static_cast<int>(i));
+        int next = 0;
+        for (auto _ : state)
+        {
+            queue.push_back(next++);
+            pop_oldest(queue);
+            benchmark::DoNotOptimize(queue.front());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Ключ сортировки, перемешанный относительно исходного порядка (мультипликативный хеш)
+    std::uint64_t scrambled(const LargePod &value) { return value.words[0] * 0x9E3779B97F4A7C15ull; }
+
+    // Сортировка списка из state.range(0) больших структур перешиванием узлов.
+    // Чётные итерации упорядочивают по перемешанному ключу, нечётные - обратно
+    // по исходному, так что на вход каждой сортировки приходит случайный порядок
+    template <typename C>
+    void BM_ListSort(benchmark::State &state)
+    {
+        C c = builder<C>::make(static_cast<int>(state.range(0)));
+        bool byScrambled = true;
+        for (auto _ : state)
+        {
+            if (byScrambled)
+                c.sort([](const LargePod &a, const LargePod &b) { return scrambled(a) < scrambled(b); });
+            else
+                c.sort([](const LargePod &a, const LargePod &b) { return a.words[0] < b.words[0]; });
+            byScrambled = !byScrambled;
+            benchmark::DoNotOptimize(c.front().words[0]);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    constexpr std::size_t snapshotCount = std::size_t(1) << 20;
+
+    // Снимок для читателя и одна запись после него:
+    // 0 - копия myvector (operator=), 1 - cow_myvector::snapshot()
+    void BM_Snapshot(benchmark::State &state)
+    {
+        myvector<int> flat;
+        cow_myvector<int> shared;
+        for (std::size_t i = 0; i < snapshotCount; ++i)
+        {
+            flat.push_back(static_cast<int>(i));
+            shared.push_back(static_cast<int>(i));
+        }
+        std::size_t next = 0;
+        for (auto _ : state)
+        {
+            next = (next + 4099) % snapshotCount;
+            if (state.range(0) == 1)
+            {
+                cow_myvector<int> snapshot = shared.snapshot();
+                shared[next] += 1;
+                benchmark::DoNotOptimize(snapshot[next]);
+            }
+            else
+            {
+                myvector<int> snapshot;
+                snapshot = flat;
+                flat[next] += 1;
+                benchmark::DoNotOptimize(snapshot[next]);
+            }
+        }
+    }
+
+    constexpr int requestItems = 256;
+
+    // Временные контейнеры одного "запроса": вектор и список, собранные и
+    // выброшенные целиком. Vector и List - с одним и тем же аллокатором
+    template <typename Vector, typename List, typename... Resource>
+    std::uint64_t handle_request(Resource *...resource)
+    {
+        Vector values{resource...};
+        List pending{resource...};
+        for (int i = 0; i < requestItems; ++i)
+        {
+            values.push_back(i);
+            if (i % 4 == 0)
+                pending.push_back(i);
+        }
+        return static_cast<std::uint64_t>(values.sum()) + pending.size();
+    }
+
+    // Память запроса: 0 - std::allocator (malloc на каждый узел и рост вектора),
+    // 1 - арена monotonic_buffer_resource на стеке, освобождаемая целиком
+    void BM_RequestArena(benchmark::State &state)
+    {
+        for (auto _ : state)
+        {
+            if (state.range(0) == 1)
+            {
+                std::byte buffer[16 * 1024];
+                std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+                benchmark::DoNotOptimize(handle_request<pmr::myvector<int>, pmr::dlist<int>>(&arena));
+            }
+            else
+            {
+                benchmark::DoNotOptimize(handle_request<myvector<int>, dlist<int>>());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * requestItems);
+    }
+}
+
+BENCHMARK(BM_RequestArena)->Arg(0)->Arg(1);
+BENCHMARK(BM_Snapshot)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ListSort, slist<LargePod>)->Arg(1 << 16)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_ListSort, std::forward_list<LargePod>)->Arg(1 << 16)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_ListSort, dlist<LargePod>)->Arg(1 << 16)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_ListSort, std::list<LargePod>)->Arg(1 << 16)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_Fifo, myvector<int>)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_Fifo, ring_buffer<int>)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_Fifo, std::deque<int>)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_Search, std::int32_t)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Search, float)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_MinMax, std::int32_t)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_MinMax, float)->Arg(0)->Arg(1);
+BENCHMARK(BM_ScanRecords);
+BENCHMARK(BM_ScanColumn);
+BENCHMARK(BM_WriteText)->Arg(0)->Arg(1);
+BENCHMARK(BM_LoadBinary)->Arg(0)->Arg(1);
+BENCHMARK(BM_Reduce)->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(BM_Sort)->Arg(0)->Arg(1)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_WorkQueue, mpsc_queue<int>)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WorkQueue, locked_slist_queue)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentAppend, concurrent_myvector<int>)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentAppend, locked_myvector)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_ShortLived, myvector<int>)->DenseRange(1, 8);
+BENCHMARK_TEMPLATE(BM_ShortLived, small_myvector<int, 8>)->DenseRange(1, 8);
+BENCHMARK_TEMPLATE(BM_ShortLived, std::vector<int>)->DenseRange(1, 8);
+BENCHMARK_TEMPLATE(BM_ShortLived, static_myvector<int, 8>)->DenseRange(1, 8);
+BENCHMARK_TEMPLATE(BM_ShortLived, slist<int>)->DenseRange(1, 8);
+BENCHMARK_TEMPLATE(BM_ShortLived, static_slist<int, 8>)->DenseRange(1, 8);
+
+// Каждый бенчмарк - на всех контейнерах для одного типа элементов
+#define LAB3_BENCH_ALL(bench, T)                                          \
+    BENCHMARK_TEMPLATE(bench, myvector<T>)->Apply(sizes<T>);          \
+    BENCHMARK_TEMPLATE(bench, std::vector<T>)->Apply(sizes<T>);       \
+    BENCHMARK_TEMPLATE(bench, slist<T>)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(bench, std::forward_list<T>)->Apply(sizes<T>); \
+    BENCHMARK_TEMPLATE(bench, dlist<T>)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(bench, rawdlist<T>)->Apply(sizes<T>);          \
+    BENCHMARK_TEMPLATE(bench, ulist<T>)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(bench, ilist<T>)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(bench, std::list<T>)->Apply(sizes<T>)
+
+#define LAB3_BENCH_WHERE(where, T)                                               \
+    BENCHMARK_TEMPLATE(BM_Insert, myvector<T>, where)->Apply(sizes<T>);          \
+    BENCHMARK_TEMPLATE(BM_Insert, std::vector<T>, where)->Apply(sizes<T>);       \
+    BENCHMARK_TEMPLATE(BM_Insert, slist<T>, where)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(BM_Insert, std::forward_list<T>, where)->Apply(sizes<T>); \
+    BENCHMARK_TEMPLATE(BM_Insert, dlist<T>, where)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(BM_Insert, rawdlist<T>, where)->Apply(sizes<T>);          \
+    BENCHMARK_TEMPLATE(BM_Insert, ulist<T>, where)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(BM_Insert, ilist<T>, where)->Apply(sizes<T>);             \
+    BENCHMARK_TEMPLATE(BM_Insert, std::list<T>, where)->Apply(sizes<T>)
+
+#define LAB3_BENCH_TYPE(T)              \
+    LAB3_BENCH_ALL(BM_PushBack, T);     \
+    LAB3_BENCH_WHERE(Where::Front, T);  \
+    LAB3_BENCH_WHERE(Where::Middle, T); \
+    LAB3_BENCH_WHERE(Where::Back, T);   \
+    LAB3_BENCH_ALL(BM_Erase, T);        \
+    LAB3_BENCH_ALL(BM_Index, T);        \
+    LAB3_BENCH_ALL(BM_Iterate, T)
+
+LAB3_BENCH_TYPE(int);
+LAB3_BENCH_TYPE(std::string);
+LAB3_BENCH_TYPE(LargePod);
+
+BENCHMARK_MAIN();
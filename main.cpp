@@ -2,6 +2,12 @@
 #include "myvector.h"
 #include "slist.h"
 #include "dlist.h"
+#include "rawdlist.h"
+#include "ulist.h"
+#include "ilist.h"
+#include "node_pool.h"
+#include "serialize.h"
+#include <cstdio>
 
 int main()
 {
@@ -125,5 +131,185 @@ int main()
         std::cout << *i << " ";
     std::cout << '\n';
 
+    // Последний элемент чужого списка в конец этого: end() здесь и итератор за
+    // последним в d2 совпадают, но элемент всё равно должен переехать
+    d4.splice(d4.end(), d2, std::prev(d2.end()));
+    d4.print();
+    std::cout << d4.size() << " " << d2.size() << std::endl;
+
+    std::cout << "\nrawdlist: " << std::endl;
+    rawdlist<int> r1;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        r1.push_back(i);
+    }
+    r1.print();
+    std::cout << r1[2] << std::endl;
+    std::cout << r1.size() << std::endl;
+    r1.erase(6);
+    r1.erase(4);
+    r1.erase(2);
+    r1.print();
+    r1.insert(10, 0);
+    r1.print();
+    r1.insert(20, r1.size() / 2);
+    r1.print();
+    r1.insert(30, r1.size());
+    r1.print();
+
+    rawdlist<int> r2 = std::move(r1);
+    r1.print();
+    r2.print();
+
+    rawdlist<int> r3;
+    r3 = r2;
+    r2.print();
+    r3.print();
+
+    rawdlist<int> r4;
+    r4 = std::move(r3);
+    r3.print();
+    r4.print();
+
+    for (auto i = r4.begin(); i != r4.end(); ++i)
+        std::cout << *i << " ";
+    std::cout << '\n';
+
+    // Последний элемент чужого списка в конец этого: end() здесь и итератор за
+    // последним в r2 совпадают, но элемент всё равно должен переехать
+    r4.splice(r4.end(), r2, std::prev(r2.end()));
+    r4.print();
+    std::cout << r4.size() << " " << r2.size() << std::endl;
+
+    std::cout << "\nulist: " << std::endl;
+    ulist<int> u1;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        u1.push_back(i);
+    }
+    u1.print();
+    std::cout << u1[2] << std::endl;
+    std::cout << u1.size() << std::endl;
+    u1.erase(6);
+    u1.erase(4);
+    u1.erase(2);
+    u1.print();
+    u1.insert(10, 0);
+    u1.print();
+    u1.insert(20, u1.size() / 2);
+    u1.print();
+    u1.insert(30, u1.size());
+    u1.print();
+
+    ulist<int> u2 = std::move(u1);
+    u1.print();
+    u2.print();
+
+    ulist<int> u3;
+    u3 = u2;
+    u2.print();
+    u3.print();
+
+    ulist<int> u4;
+    u4 = std::move(u3);
+    u3.print();
+    u4.print();
+
+    for (auto i = u4.begin(); i != u4.end(); ++i)
+        std::cout << *i << " ";
+    std::cout << '\n';
+
+    std::cout << "\nilist: " << std::endl;
+    ilist<int> i1;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        i1.push_back(i);
+    }
+    i1.print();
+    std::cout << i1[2] << std::endl;
+    std::cout << i1.size() << std::endl;
+    i1.erase(6);
+    i1.erase(4);
+    i1.erase(2);
+    i1.print();
+    i1.insert(10, 0);
+    i1.print();
+    i1.insert(20, i1.size() / 2);
+    i1.print();
+    i1.insert(30, i1.size());
+    i1.print();
+
+    ilist<int> i2 = std::move(i1);
+    i1.print();
+    i2.print();
+
+    ilist<int> i3;
+    i3 = i2;
+    i2.print();
+    i3.print();
+
+    ilist<int> i4;
+    i4 = std::move(i3);
+    i3.print();
+    i4.print();
+
+    for (auto i = i4.begin(); i != i4.end(); ++i)
+        std::cout << *i << " ";
+    std::cout << '\n';
+
+    // Аллокатор с состоянием: удалитель узла slist хранит указатель на пул.
+    // Без пула pool_allocator берёт память у operator new и сразу возвращает её
+    // при удалении узла - так ошибки с удалителем из уже удалённого узла заметны
+    std::cout << "\nslist / dlist + pool_allocator: " << std::endl;
+    node_pool pool;
+    slist<int, pool_allocator<int>> p1{pool_allocator<int>(pool)};
+    slist<int, pool_allocator<int>> p2;
+    dlist<int, pool_allocator<int>> p3{pool_allocator<int>(pool)};
+    for (int i = 0; i < 10; ++i)
+    {
+        p1.push_back(i);
+        p2.push_back(i);
+        p3.push_back(i);
+    }
+    p1.erase(6);
+    p1.erase(3);
+    p1.erase(0);
+    p1.print();
+    p2.erase(6);
+    p2.erase(3);
+    p2.erase(0);
+    p2.print();
+    p3.erase(6);
+    p3.erase(3);
+    p3.erase(0);
+    p3.print();
+    p1.clear();
+    p2.clear();
+    p3.clear();
+    std::cout << p1.size() << " " << p2.size() << " " << p3.size() << std::endl;
+
+    // Двоичный файл: запись, чтение в myvector и отображение в память
+    std::cout << "\nsave_binary / load_binary / mapped_myvector: " << std::endl;
+    const char *binaryPath = "lab3_demo.bin";
+    myvector<int> b1;
+    for (int i = 0; i < 10; ++i)
+    {
+        b1.push_back(i * i);
+    }
+    save_binary(b1, binaryPath);
+    myvector<int> b2;
+    load_binary(b2, binaryPath);
+    b2.print();
+    {
+        mapped_myvector<int> mapped(binaryPath);
+        writable_mapped_myvector<int> patched(binaryPath);
+        patched[0] = -1; // меняется только своя копия страницы, файл прежний
+        std::cout << mapped.size() << " " << mapped[9] << " " << patched[0] << " " << mapped[0] << std::endl;
+    }
+    std::remove(binaryPath);
+
     return 0;
 }
\ No newline at end of file
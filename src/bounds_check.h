@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+
+// Проверка границ в operator[], front() и back() контейнеров.
+// По умолчанию включена в отладочной сборке и выключена в release (CMake
+// определяет там NDEBUG): доступ по индексу в горячем цикле становится простым
+// обращением к памяти - без ветвления и исключений, и такой цикл векторизуется.
+// Явно задаётся флагом -DLAB3_BOUNDS_CHECK=1 (или 0). at() проверяет индекс всегда.
+#ifndef LAB3_BOUNDS_CHECK
+#ifdef NDEBUG
+#define LAB3_BOUNDS_CHECK 0
+#else
+#define LAB3_BOUNDS_CHECK 1
+#endif
+#endif
+
+// Бросает out_of_range, если index не меньше length (годится и для вычислений при компиляции)
+constexpr void check_index(std::size_t index, std::size_t length)
+{
+    if (index >= length)
+        throw std::out_of_range("Index out of range");
+}
+
+// Бросает out_of_range с сообщением message, если контейнер пуст
+constexpr void check_not_empty(bool empty, const char *message)
+{
+    if (empty)
+        throw std::out_of_range(message);
+}
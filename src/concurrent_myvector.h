@@ -0,0 +1,342 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "bounds_check.h"
+#include "mpsc_queue.h"
+#include "myvector.h"
+
+// Ячейка concurrent_myvector: значение в сырой памяти и флаг "построено".
+// Флаг ставит поток, добавивший элемент, после конструирования (release),
+// читатели проверяют его (acquire) - так элемент публикуется без блокировок
+template <typename T>
+struct ConcurrentSlot
+{
+    alignas(T) unsigned char storage[sizeof(T)];
+    std::atomic<bool> ready{false};
+
+    ConcurrentSlot() {}
+
+    T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+    const T *value() const { return std::launder(reinterpret_cast<const T *>(storage)); }
+};
+
+// Вектор с добавлением из многих потоков без мьютекса.
+//
+// Память - сегменты, которые никогда не переносятся: сегмент 0 на
+// 2^first_bits элементов, каждый следующий вдвое больше предыдущего. Номер
+// сегмента и место в нём вычисляются из индекса парой сдвигов, поэтому ссылки
+// и указатели на элементы действительны, пока жив вектор (или до clear()).
+//
+// push_back()/emplace_back() из любого числа потоков: индекс занимается одним
+// fetch_add, сегмент выделяет ровно один поток - первый, кто захватил его флаг
+// постройки; остальные, кому он нужен, ждут публикации указателя. Элемент
+// строится на месте и публикуется флагом готовности. Результат - индекс нового
+// элемента.
+//
+// Читать элемент по индексу можно параллельно с добавлением, если его
+// push_back уже завершился (индекс получен от добавившего потока). at()
+// проверяет и это. iterate_snapshot() обходит все готовые элементы, не мешая
+// писателям. clear(), деструктор и to_myvector() с писателями не пересекаются.
+//
+// Ячейка хранит флаг рядом со значением: для int это 8 байт на элемент.
+// Аллокатор вызывается из потоков-писателей конкурентно и должен быть
+// потокобезопасным (std::allocator подходит, pool_allocator из node_pool.h - нет).
+template <typename T, typename Alloc = std::allocator<T>>
+class concurrent_myvector
+{
+private:
+    using slot_type = ConcurrentSlot<T>;
+    using slot_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<slot_type>;
+    using slot_traits = std::allocator_traits<slot_allocator>;
+
+    static constexpr std::size_t first_bits = 5; // в сегменте 0 - 32 элемента
+    static constexpr std::size_t index_bits = std::numeric_limits<std::size_t>::digits;
+    // Больше сегментов не бывает: у последнего размер уже не помещается в size_t
+    static constexpr std::size_t max_segments = index_bits - first_bits;
+
+    slot_allocator alloc;
+
+    // Счётчик занятых индексов - самая горячая переменная, отдельно от таблицы сегментов
+    alignas(queue_cache_line) std::atomic<std::size_t> claimed{0};
+    alignas(queue_cache_line) std::atomic<slot_type *> segments[max_segments];
+    // Флаг постройки сегмента: сегмент выделяет тот, кто первым его поднял
+    std::atomic<bool> building[max_segments];
+
+    static std::size_t segment_size(std::size_t segment)
+    {
+        return std::size_t(1) << (segment + first_bits);
+    }
+
+    // Номер старшего единичного бита (value > 0)
+    static std::size_t floor_log2(std::size_t value)
+    {
+#if defined(__GNUC__)
+        return std::numeric_limits<unsigned long long>::digits - 1 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+        std::size_t bit = 0;
+        while (value >>= 1)
+            bit++;
+        return bit;
+#endif
+    }
+
+    // Сегмент и место в нём для индекса: сегмент k начинается с (2^k - 1) * 2^first_bits
+    static void locate(std::size_t index, std::size_t &segment, std::size_t &offset)
+    {
+        segment = floor_log2((index >> first_bits) + 1);
+        offset = index - (((std::size_t(1) << segment) - 1) << first_bits);
+    }
+
+    // Сегмент номер segment, создаётся при первом обращении (из любого потока)
+    slot_type *segment_at(std::size_t segment)
+    {
+        if (segment >= max_segments)
+            throw std::length_error("concurrent_myvector is too long");
+
+        for (;;)
+        {
+            slot_type *current = segments[segment].load(std::memory_order_acquire);
+            if (current != nullptr)
+                return current;
+            if (!building[segment].exchange(true, std::memory_order_acquire))
+                return build_segment(segment);
+            // Сегмент строит другой поток: ждём указатель, не выделяя свой
+            std::this_thread::yield();
+        }
+    }
+
+    // Выделяет и публикует сегмент (вызывает только поток, поднявший флаг постройки).
+    // Если выделение бросит исключение, флаг снимается - сегмент построит следующий
+    slot_type *build_segment(std::size_t segment)
+    {
+        const std::size_t count = segment_size(segment);
+        slot_type *fresh;
+        try
+        {
+            fresh = slot_traits::allocate(alloc, count);
+        }
+        catch (...)
+        {
+            building[segment].store(false, std::memory_order_release);
+            throw;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+            slot_traits::construct(alloc, fresh + i);
+        segments[segment].store(fresh, std::memory_order_release);
+        return fresh;
+    }
+
+    void free_segment(slot_type *segment, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            slot_traits::destroy(alloc, segment + i);
+        slot_traits::deallocate(alloc, segment, count);
+    }
+
+    // Ячейка элемента index (nullptr, если её сегмент ещё не создан)
+    slot_type *find_slot(std::size_t index) const
+    {
+        std::size_t segment;
+        std::size_t offset;
+        locate(index, segment, offset);
+        if (segment >= max_segments)
+            return nullptr;
+        slot_type *base = segments[segment].load(std::memory_order_acquire);
+        return base == nullptr ? nullptr : base + offset;
+    }
+
+    // Ячейка уже построенного элемента index, иначе out_of_range
+    slot_type *checked_slot(std::size_t index) const
+    {
+        check_index(index, claimed.load(std::memory_order_acquire));
+        slot_type *slot = find_slot(index);
+        if (slot == nullptr || !slot->ready.load(std::memory_order_acquire))
+            throw std::out_of_range("Index out of range");
+        return slot;
+    }
+
+    // Уничтожает готовые элементы; с remove - и освобождает сегменты
+    void destroy_all(bool remove)
+    {
+        for (std::size_t segment = 0; segment < max_segments; ++segment)
+        {
+            slot_type *base = segments[segment].load(std::memory_order_acquire);
+            if (base == nullptr)
+                continue;
+            const std::size_t count = segment_size(segment);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (base[i].ready.load(std::memory_order_relaxed))
+                {
+                    std::destroy_at(base[i].value());
+                    base[i].ready.store(false, std::memory_order_relaxed);
+                }
+            }
+            if (remove)
+            {
+                free_segment(base, count);
+                segments[segment].store(nullptr, std::memory_order_relaxed);
+                building[segment].store(false, std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    explicit concurrent_myvector(const Alloc &allocator = Alloc()) : alloc(allocator)
+    {
+        for (std::atomic<slot_type *> &segment : segments)
+            segment.store(nullptr, std::memory_order_relaxed);
+        for (std::atomic<bool> &flag : building)
+            flag.store(false, std::memory_order_relaxed);
+    }
+
+    // Сегменты и атомарные счётчики не копируются и не переносятся
+    concurrent_myvector(const concurrent_myvector &) = delete;
+    concurrent_myvector &operator=(const concurrent_myvector &) = delete;
+
+    // Деструктор (когда писатели закончили)
+    ~concurrent_myvector()
+    {
+        destroy_all(true);
+    }
+
+    Alloc get_allocator() const
+    {
+        return Alloc(alloc);
+    }
+
+    // Добавление в конец (из любого потока). Возвращает индекс элемента
+    std::size_t push_back(T &value)
+    {
+        return emplace_back(value);
+    }
+
+    std::size_t push_back(T &&value)
+    {
+        return emplace_back(std::move(value));
+    }
+
+    // Элемент конструируется прямо в ячейке из args (из любого потока).
+    // Если конструктор или выделение сегмента бросит исключение, индекс останется пустым: at() и
+    // iterate_snapshot() его пропускают
+    template <typename... Args>
+    std::size_t emplace_back(Args &&...args)
+    {
+        const std::size_t index = claimed.fetch_add(1, std::memory_order_relaxed);
+        std::size_t segment;
+        std::size_t offset;
+        locate(index, segment, offset);
+        slot_type &slot = segment_at(segment)[offset];
+        ::new (static_cast<void *>(slot.storage)) T(std::forward<Args>(args)...);
+        slot.ready.store(true, std::memory_order_release);
+        return index;
+    }
+
+    // Заранее создаёт сегменты под count элементов (можно при работающих писателях):
+    // писатели не будут выделять память, пока индексы не перейдут count
+    void reserve(std::size_t count)
+    {
+        if (count == 0)
+            return;
+        std::size_t last;
+        std::size_t offset;
+        locate(count - 1, last, offset);
+        for (std::size_t segment = 0; segment <= last; ++segment)
+            segment_at(segment);
+    }
+
+    // Число занятых индексов - вместе с элементами, которые ещё строятся
+    std::size_t size() const
+    {
+        return claimed.load(std::memory_order_acquire);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    // Доступ по индексу уже добавленного элемента (push_back вернул управление).
+    // Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, size());
+        return *find_slot(index)->value();
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, size());
+        return *find_slot(index)->value();
+    }
+
+    // Доступ с проверкой: индекс занят и элемент уже построен
+    T &at(std::size_t index)
+    {
+        return *checked_slot(index)->value();
+    }
+
+    const T &at(std::size_t index) const
+    {
+        return *checked_slot(index)->value();
+    }
+
+    // Обход готовых элементов по возрастанию индекса, параллельно с писателями.
+    // Видны все элементы, чей push_back завершился до вызова; добавляемые во
+    // время обхода - как получится. Возвращает число переданных в f
+    template <typename F>
+    std::size_t iterate_snapshot(F &&f) const
+    {
+        const std::size_t count = size();
+        std::size_t visited = 0;
+        std::size_t start = 0;
+        for (std::size_t segment = 0; segment < max_segments && start < count; ++segment)
+        {
+            const std::size_t length = segment_size(segment);
+            const slot_type *base = segments[segment].load(std::memory_order_acquire);
+            if (base != nullptr)
+            {
+                const std::size_t used = std::min(length, count - start);
+                for (std::size_t i = 0; i < used; ++i)
+                {
+                    if (base[i].ready.load(std::memory_order_acquire))
+                    {
+                        f(static_cast<const T &>(*base[i].value()));
+                        visited++;
+                    }
+                }
+            }
+            start += length;
+        }
+        return visited;
+    }
+
+    // Копия готовых элементов в обычный непрерывный вектор
+    myvector<T> to_myvector() const
+    {
+        myvector<T> flat;
+        flat.reserve(size());
+        iterate_snapshot([&flat](const T &value) { flat.emplace_back(value); });
+        return flat;
+    }
+
+    // Удаляет все элементы, сегменты остаются для следующих добавлений
+    // (когда писателей нет)
+    void clear()
+    {
+        destroy_all(false);
+        claimed.store(0, std::memory_order_release);
+    }
+};
@@ -0,0 +1,387 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "bounds_check.h"
+#include "myvector.h"
+#include "write_buffer.h"
+
+// Вектор со снимками (copy-on-write): копия и snapshot() - O(1), копия делит
+// память с исходным вектором, а запись копирует только то, что меняет.
+//
+// Элементы лежат кусками по Chunk штук (каждый кусок - свой myvector), куски
+// и таблица указателей на них - под shared_ptr. Снимок разделяет таблицу.
+// Первая запись после снимка копирует таблицу (size() / Chunk указателей) и
+// изменяемый кусок; остальные куски остаются общими, следующие записи в тот же
+// кусок уже ничего не копируют.
+//
+// Потоки: снимки, отданные читателям, можно читать параллельно с записью в
+// исходный вектор - писатель не трогает кусок, которым владеет кто-то ещё.
+// Один и тот же объект cow_myvector из нескольких потоков одновременно
+// (чтение + запись) использовать нельзя, как и любой другой контейнер.
+//
+// Вставка и удаление - только в конце (push_back/pop_back): все куски, кроме
+// последнего, всегда полные, и элемент i лежит в куске i / Chunk.
+template <typename T, std::size_t Chunk = std::max<std::size_t>(1, 4096 / sizeof(T))>
+class cow_myvector
+{
+    static_assert(Chunk > 0, "chunk must hold at least one element");
+
+private:
+    using chunk = myvector<T>;
+    using table = myvector<std::shared_ptr<chunk>>;
+
+    std::shared_ptr<table> chunks; // таблица кусков (nullptr - вектор пуст и ничего не выделено)
+    std::size_t length = 0;
+
+    // Единственный ли владелец у ptr: тогда его можно менять на месте.
+    // Acquire - чтобы чтения бывших совладельцев (до их release при уничтожении
+    // shared_ptr) завершились раньше нашей записи
+    template <typename U>
+    static bool owned(const std::shared_ptr<U> &ptr)
+    {
+        if (ptr.use_count() != 1)
+            return false;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+
+    // Новый пустой кусок с ёмкостью на Chunk элементов
+    static std::shared_ptr<chunk> make_chunk()
+    {
+        std::shared_ptr<chunk> piece = std::make_shared<chunk>();
+        piece->reserve(Chunk);
+        return piece;
+    }
+
+    // Своя копия таблицы: копируются только указатели, куски остаются общими
+    table &own_table()
+    {
+        if (chunks == nullptr)
+        {
+            chunks = std::make_shared<table>();
+        }
+        else if (!owned(chunks))
+        {
+            std::shared_ptr<table> copy = std::make_shared<table>();
+            copy->reserve(chunks->size());
+            for (std::shared_ptr<chunk> &piece : *chunks)
+                copy->push_back(piece);
+            chunks = std::move(copy);
+        }
+        return *chunks;
+    }
+
+    // Свой кусок с номером index (таблица к этому моменту своя)
+    chunk &own_chunk(std::size_t index)
+    {
+        std::shared_ptr<chunk> &piece = (*chunks)[index];
+        if (!owned(piece))
+        {
+            std::shared_ptr<chunk> copy = make_chunk();
+            copy->append_range(piece->begin(), piece->end());
+            piece = std::move(copy);
+        }
+        return *piece;
+    }
+
+    // Элемент для записи: таблица и кусок с ним становятся своими
+    T &writable(std::size_t index)
+    {
+        own_table();
+        return own_chunk(index / Chunk)[index % Chunk];
+    }
+
+    const T &element(std::size_t index) const
+    {
+        return (*(*chunks)[index / Chunk])[index % Chunk];
+    }
+
+    // Последний кусок со свободным местом (новый, если последний полон)
+    chunk &tail_for_push()
+    {
+        table &pieces = own_table();
+        if (length % Chunk == 0)
+        {
+            pieces.push_back(make_chunk());
+            return *pieces.back();
+        }
+        return own_chunk(pieces.size() - 1);
+    }
+
+public:
+    cow_myvector() = default;
+
+    cow_myvector(std::initializer_list<T> init)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    cow_myvector(InputIt first, InputIt last)
+    {
+        append_range(first, last);
+    }
+
+    // Копия - O(1): память общая, пока одна из копий не начнёт запись
+    cow_myvector(const cow_myvector &other) : chunks(other.chunks), length(other.length) {}
+
+    cow_myvector(cow_myvector &&other) : chunks(std::move(other.chunks)), length(std::exchange(other.length, 0)) {}
+
+    cow_myvector &operator=(const cow_myvector &other)
+    {
+        chunks = other.chunks;
+        length = other.length;
+        return *this;
+    }
+
+    cow_myvector &operator=(cow_myvector &&other)
+    {
+        if (this == &other)
+            return *this;
+        chunks = std::move(other.chunks);
+        length = std::exchange(other.length, 0);
+        return *this;
+    }
+
+    // Снимок текущего содержимого за O(1): дальнейшие записи в этот вектор его не меняют
+    cow_myvector snapshot() const
+    {
+        return *this;
+    }
+
+    // Делят ли два вектора хотя бы таблицу кусков (снимок ещё не разошёлся с исходником)
+    bool shares_with(const cow_myvector &other) const
+    {
+        return chunks != nullptr && chunks == other.chunks;
+    }
+
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Чтение по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return element(index);
+    }
+
+    // Запись по индексу: кусок с элементом копируется, если он общий со снимком.
+    // Ссылка действительна до следующего снимка или копии вектора
+    T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return writable(index);
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return element(index);
+    }
+
+    T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return writable(index);
+    }
+
+    // Первый и последний элементы. Пустой вектор проверяется только при LAB3_BOUNDS_CHECK
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return element(0);
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return element(length - 1);
+    }
+
+    // Добавление в конец: копируется (если общий) только последний кусок
+    void push_back(T &value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        // args могут ссылаться на элемент этого же вектора - строим значение до копирования кусков
+        T value(std::forward<Args>(args)...);
+        T &added = tail_for_push().emplace_back(std::move(value));
+        length++;
+        return added;
+    }
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    // Удаление последнего элемента
+    void pop_back()
+    {
+        if (length == 0)
+            throw std::out_of_range("Vector is empty");
+        table &pieces = own_table();
+        if (length % Chunk == 1 || Chunk == 1)
+            pieces.erase(pieces.size() - 1); // кусок опустел - просто отпускаем его
+        else
+            own_chunk(pieces.size() - 1).erase((length - 1) % Chunk);
+        length--;
+    }
+
+    // Удаляет все элементы; снимки сохраняют своё содержимое
+    void clear()
+    {
+        chunks.reset();
+        length = 0;
+    }
+
+    // Обычный непрерывный вектор с копией элементов
+    myvector<T> to_myvector() const
+    {
+        myvector<T> flat;
+        flat.reserve(length);
+        flat.append_range(begin(), end());
+        return flat;
+    }
+
+    // Итератор произвольного доступа только для чтения (запись - через operator[]):
+    // номер элемента и вектор, внутри куска - обычный указатель
+    class ConstIterator
+    {
+        const cow_myvector *owner;
+        std::ptrdiff_t index;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        ConstIterator() : owner(nullptr), index(0) {}
+        ConstIterator(const cow_myvector *vect, std::ptrdiff_t i) : owner(vect), index(i) {}
+
+        reference operator*() const { return owner->element(static_cast<std::size_t>(index)); }
+        pointer operator->() const { return &**this; }
+        reference get() const { return **this; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        ConstIterator &operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        ConstIterator operator++(int)
+        {
+            ConstIterator old = *this;
+            ++index;
+            return old;
+        }
+
+        ConstIterator &operator--()
+        {
+            --index;
+            return *this;
+        }
+
+        ConstIterator operator--(int)
+        {
+            ConstIterator old = *this;
+            --index;
+            return old;
+        }
+
+        ConstIterator &operator+=(difference_type n)
+        {
+            index += n;
+            return *this;
+        }
+
+        ConstIterator &operator-=(difference_type n)
+        {
+            index -= n;
+            return *this;
+        }
+
+        friend ConstIterator operator+(ConstIterator it, difference_type n) { return it += n; }
+        friend ConstIterator operator+(difference_type n, ConstIterator it) { return it += n; }
+        friend ConstIterator operator-(ConstIterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const ConstIterator &a, const ConstIterator &b) { return a.index - b.index; }
+
+        friend bool operator==(const ConstIterator &a, const ConstIterator &b) { return a.index == b.index; }
+        friend bool operator!=(const ConstIterator &a, const ConstIterator &b) { return a.index != b.index; }
+        friend bool operator<(const ConstIterator &a, const ConstIterator &b) { return a.index < b.index; }
+        friend bool operator>(const ConstIterator &a, const ConstIterator &b) { return a.index > b.index; }
+        friend bool operator<=(const ConstIterator &a, const ConstIterator &b) { return a.index <= b.index; }
+        friend bool operator>=(const ConstIterator &a, const ConstIterator &b) { return a.index >= b.index; }
+    };
+
+    using value_type = T;
+    using const_reference = const T &;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = ConstIterator;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, static_cast<std::ptrdiff_t>(length)); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    // Печать всех элементов (для отладки)
+    void print() const
+    {
+        print_range(begin(), end());
+    }
+
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
+    }
+};
@@ -3,6 +3,16 @@
 #include <iostream>
 #include <utility>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <initializer_list>
+#include <functional>
+#include "bounds_check.h"
+#include "write_buffer.h"
+#include "stats.h"
+#include "list_algorithms.h"
 
 // Узел двусвязного списка.
 // Хранит значение, указатель на следующий узел (shared_ptr - владеет им),
@@ -14,315 +24,851 @@ struct DoubleNode
     std::shared_ptr<DoubleNode<T>> next; // владеющий указатель на следующий узел
     std::weak_ptr<DoubleNode<T>> prev;   // невладеющий указатель на предыдущий узел
 
-    // Конструктор для lvalue
-    DoubleNode(T &val)
-    {
-        value = val;  // копируем значение
-        next.reset(); // next = nullptr
-        prev.reset(); // prev = nullptr (weak_ptr тоже можно reset'ить)
-    }
+    // Конструктор для lvalue: копируем значение (next и prev пусты)
+    DoubleNode(const T &val) : value(val) {}
 
-    // Конструктор для rvalue
-    DoubleNode(T &&val)
-    {
-        value = std::move(val); // перемещаем, если возможно (например, для string, vector)
-        next.reset();
-        prev.reset();
-    }
+    // Конструктор для rvalue: перемещаем, если возможно (например, для string, vector)
+    DoubleNode(T &&val) : value(std::move(val)) {}
+
+    // Конструирование значения на месте из аргументов его конструктора (для emplace)
+    template <typename... Args>
+    explicit DoubleNode(std::in_place_t, Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    ~DoubleNode() { stats_free(container_kind::dlist, sizeof(DoubleNode)); }
 };
 
 // Двусвязный список на умных указателях.
 // Поддерживает вставку, удаление, доступ по индексу и итерацию.
-template <typename T>
+// Узлы создаются через std::allocate_shared с аллокатором Alloc: узел и блок
+// управления shared_ptr лежат в одной ячейке, взятой у аллокатора. С pool_allocator
+// (node_pool.h) ячейки нарезаются из общих блоков и переиспользуются после erase.
+template <typename T, typename Alloc = std::allocator<T>>
 class dlist
 {
 private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    Alloc alloc;                         // аллокатор узлов
     std::shared_ptr<DoubleNode<T>> head; // первый элемент списка (nullptr если пуст)
-    int length;                          // текущее количество элементов
+    std::shared_ptr<DoubleNode<T>> tail; // последний элемент (второй владелец последнего узла)
+    std::size_t length;                  // текущее количество элементов
 
-public:
-    // Конструктор пустого списка
-    dlist()
+    // Создаёт узел через аллокатор списка; блок управления запомнит аллокатор
+    // и вернёт ему память, когда исчезнет последний владелец узла
+    template <typename... Args>
+    std::shared_ptr<DoubleNode<T>> make_node(Args &&...args)
     {
-        head = nullptr;
-        length = 0;
+        std::shared_ptr<DoubleNode<T>> node =
+            std::allocate_shared<DoubleNode<T>>(alloc, std::in_place, std::forward<Args>(args)...);
+        stats_alloc(container_kind::dlist, sizeof(DoubleNode<T>));
+        return node;
     }
 
-    // Move-конструктор: "перехватывает" ресурсы из другого списка
-    dlist(dlist &&list)
+    // Забирает цепочку узлов другого списка (свой список должен быть пуст)
+    void steal(dlist &list)
     {
         head = std::move(list.head); // передаём владение узлами
+        tail = std::move(list.tail);
         length = list.length;
 
         // Оставляем исходный список в валидном (но пустом) состоянии
         list.head = nullptr;
+        list.tail = nullptr;
         list.length = 0;
     }
 
-    // Деструктор не нужен: shared_ptr сам очистит память
-    ~dlist() = default;
-
-    // Вставка в конец: версия для lvalue (копирование)
-    void push_back(T &value)
+    // Присоединяет готовый узел в конец за O(1) через tail
+    void link_back(std::shared_ptr<DoubleNode<T>> newNode)
     {
-        // Создаём новый узел с копией значения
-        std::shared_ptr<DoubleNode<T>> newNode = std::make_shared<DoubleNode<T>>(value);
         if (head == nullptr)
         {
             head = newNode; // первый элемент
-            length++;
-            return;
         }
+        else
+        {
+            newNode->prev = tail; // слабая ссылка на текущий последний
+            tail->next = newNode; // текущий теперь указывает на новый
+        }
+        tail = std::move(newNode);
+        length++;
+    }
 
-        // Идём до конца списка
-        auto cur = head;
-        while (cur->next)
+    // Узел с номером index (0 <= index < length). Обход идёт с ближнего к index
+    // конца: от head по next или от tail по prev, так что до любой позиции не
+    // больше length / 2 шагов.
+    DoubleNode<T> *node_at(std::size_t index) const
+    {
+        stats_walk(container_kind::dlist, index < length / 2 ? index : length - 1 - index);
+        if (index < length / 2)
         {
-            cur = cur->next;
+            DoubleNode<T> *cur = head.get();
+            for (std::size_t cnt = 0; cnt < index; ++cnt)
+                cur = cur->next.get();
+            return cur;
         }
 
-        // Связываем новый узел
-        newNode->prev = cur; // слабая ссылка на текущий последний
-        cur->next = newNode; // текущий теперь указывает на новый
-        length++;
+        DoubleNode<T> *cur = tail.get();
+        for (std::size_t cnt = length - 1; cnt > index; --cnt)
+            cur = cur->prev.lock().get(); // узлом владеет список, указатель остаётся живым
+        return cur;
+    }
+
+public:
+    // Конструктор пустого списка
+    dlist() : dlist(Alloc()) {}
+
+    // Пустой список, узлы которого будут выделяться через allocator
+    explicit dlist(const Alloc &allocator) : alloc(allocator)
+    {
+        head = nullptr;
+        tail = nullptr;
+        length = 0;
+    }
+
+    // Список из списка инициализации
+    dlist(std::initializer_list<T> init, const Alloc &allocator = Alloc()) : dlist(allocator)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    // Список из диапазона итераторов [first, last): узлы цепляются за один проход
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    dlist(InputIt first, InputIt last, const Alloc &allocator = Alloc()) : dlist(allocator)
+    {
+        append_range(first, last);
+    }
+
+    // Move-конструктор: "перехватывает" ресурсы (и аллокатор) из другого списка
+    dlist(dlist &&list) : alloc(std::move(list.alloc))
+    {
+        steal(list);
+    }
+
+    // Аллокатор, которым список выделяет узлы
+    Alloc get_allocator() const
+    {
+        return alloc;
+    }
+
+    // Деструктор: узлы освобождаются в цикле (см. clear()), а не цепочкой
+    // рекурсивных деструкторов shared_ptr - иначе длинный список переполнит стек
+    ~dlist()
+    {
+        clear();
+    }
+
+    // Удаляет все элементы.
+    // head по очереди переходит на свой next; старый узел к моменту уничтожения
+    // уже не владеет следующим - глубина вызовов не зависит от длины списка.
+    void clear()
+    {
+        tail.reset();
+        while (head != nullptr)
+        {
+            head = std::move(head->next);
+        }
+        length = 0;
+    }
+
+    // Вставка в конец: версия для lvalue (копирование)
+    void push_back(T &value)
+    {
+        // Создаём новый узел с копией значения и цепляем его за tail
+        link_back(make_node(value));
     }
 
     // Вставка в конец: версия для rvalue (перемещение)
     void push_back(T &&value)
     {
         // Создаём узел, перемещая значение (если тип поддерживает move)
-        std::shared_ptr<DoubleNode<T>> newNode = std::make_shared<DoubleNode<T>>(std::move(value));
+        link_back(make_node(std::move(value)));
+    }
+
+    // Вставка в конец: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        link_back(make_node(std::forward<Args>(args)...));
+        return tail->value;
+    }
+
+    // Вставка в начало: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return emplace(0, std::forward<Args>(args)...);
+    }
+
+    // Вставка в начало: версия для lvalue (копирование)
+    void push_front(T &value)
+    {
+        insert(value, 0);
+    }
+
+    // Вставка в начало: версия для rvalue (перемещение)
+    void push_front(T &&value)
+    {
+        insert(std::move(value), 0);
+    }
+
+    // Удаление первого элемента
+    void pop_front()
+    {
         if (head == nullptr)
-        {
-            head = newNode;
-            length++;
-            return;
-        }
+            throw std::out_of_range("List is empty");
+        erase(0);
+    }
 
-        auto cur = head;
-        while (cur->next)
-        {
-            cur = cur->next;
-        }
-        newNode->prev = cur;
-        cur->next = newNode;
-        length++;
+    // Первый элемент за O(1). Пустой список проверяется только при LAB3_BOUNDS_CHECK
+    T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->value;
+    }
+
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->value;
+    }
+
+    // Последний элемент за O(1)
+    T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
     }
 
     // Простой вывод списка
-    void print()
+    void print() const
     {
-        auto cur = head;
-        while (cur != nullptr)
-        {
-            std::cout << cur->value << ' ';
-            cur = cur->next;
-        }
-        std::cout << '\n';
+        print_range(begin(), end());
+    }
+
+    // Вывод элементов через separator: текст копится в буфере и уходит в поток
+    // блоками по write_chunk_size байт, числа форматируются std::to_chars
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Потоковый режим: готовые блоки текста передаются в sink(const char *data, std::size_t size)
+    // по мере заполнения буфера - весь вывод целиком в памяти не собирается
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
     }
 
     // Возвращает текущую длину
-    int size()
+    std::size_t size() const
     {
         return length;
     }
 
-    // Доступ по индексу (с проверкой границ)
-    T &operator[](int index)
+    // Пуст ли список
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index)
     {
-        if (index < 0 || index >= length)
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Вставка в произвольную позицию: элемент конструируется прямо в узле из args.
+    // Возвращает ссылку на вставленный элемент.
+    template <typename... Args>
+    T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
             throw std::out_of_range("Index out of range");
 
-        int cnt = 0;
-        auto cur = head;
-        while (cnt < index)
+        std::shared_ptr<DoubleNode<T>> newNode = make_node(std::forward<Args>(args)...);
+        T &value = newNode->value;
+
+        if (position == length)
         {
-            cur = cur->next;
-            cnt++;
+            // Вставка в конец (в т.ч. в пустой список) - без обхода
+            link_back(std::move(newNode));
+            return value;
         }
-        return cur->value; // возвращаем ссылку - можно менять значение
+
+        // Вставляем перед узлом, стоящим сейчас на позиции position
+        link_before(ConstIterator(node_at(position), this), std::move(newNode));
+        return value;
     }
 
-    // Вставка в произвольную позицию
-    void insert(T &&value, int position)
+    // Вставка в произвольную позицию: перемещение
+    void insert(T &&value, std::size_t position)
+    {
+        emplace(position, std::move(value));
+    }
+
+    // Вставка в произвольную позицию: копирование
+    void insert(T &value, std::size_t position)
     {
-        if (position > length || position < 0)
-            throw std::out_of_range("Index out_of_range");
+        emplace(position, value);
+    }
 
-        // Создаём узел с перемещённым значением
-        std::shared_ptr<DoubleNode<T>> newNode = std::make_shared<DoubleNode<T>>(std::move(value));
+    // Удаление по индексу
+    void erase(std::size_t position)
+    {
+        if (position >= length)
+            throw std::out_of_range("Index out of range");
+        erase(ConstIterator(node_at(position), this));
+    }
 
-        if (position == 0)
+    // Move-присваивание
+    dlist &operator=(dlist &&list)
+    {
+        if (this == &list)
+            return *this; // самоприсваивание
+
+        clear(); // старую цепочку освобождаем итеративно
+
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc = list.alloc; // аллокатор уходит вместе с узлами
+        }
+        else if (!(alloc == list.alloc))
         {
-            // Вставка в начало
-            if (head != nullptr)
+            // Узлы другого аллокатора забрать нельзя - перемещаем значения в свои узлы
+            for (DoubleNode<T> *cur = list.head.get(); cur != nullptr; cur = cur->next.get())
             {
-                head->prev = newNode; // старый head теперь ссылается назад
-                newNode->next = head; // новый узел указывает на старый head
+                link_back(make_node(std::move(cur->value)));
             }
-            head = newNode;
-            length++;
-            return;
+            list.clear();
+            return *this;
         }
 
-        // Ищем узел ДО позиции вставки
-        auto cur = head;
-        int cnt = 0;
-        while (cnt < position - 1)
+        steal(list);
+        return *this;
+    }
+
+    // Copy-присваивание: создаёт копию поэлементно
+    dlist &operator=(dlist &list)
+    {
+        if (this == &list)
+            return *this;
+
+        // Очищаем текущий список
+        clear();
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
         {
-            cur = cur->next;
-            cnt++;
+            alloc = list.alloc;
         }
 
-        // Вставляем между cur и cur->next
-        newNode->next = cur->next;
-        if (newNode->next != nullptr)
+        // Копируем все элементы, каждый новый узел цепляется за tail за O(1).
+        // Обход источника - по сырым указателям, без копирования shared_ptr.
+        DoubleNode<T> *cur = list.head.get();
+        while (cur != nullptr)
         {
-            newNode->next->prev = newNode; // обновляем prev у следующего узла
+            link_back(make_node(cur->value));
+            cur = cur->next.get();
         }
-        newNode->prev = cur;
-        cur->next = newNode;
-        length++;
+        return *this;
     }
 
-    // Вставка в произвольную позицию: копирование
-    void insert(T &value, int position)
+    // Двунаправленный итератор (поддерживает range-based for, обратный обход и
+    // алгоритмы STL). Кроме узла хранит список-владелец: end() - это nullptr,
+    // и шаг назад от него должен попасть в tail. IsConst = true - только для чтения.
+    template <bool IsConst>
+    class BasicIterator
     {
-        // Аналогично, но копируем значение
-        if (position > length || position < 0)
-            throw std::out_of_range("Index out of range");
+        using node = std::conditional_t<IsConst, const DoubleNode<T>, DoubleNode<T>>;
+
+        node *ptr;           // сырой указатель на текущий узел (nullptr - конец)
+        const dlist *owner;  // список, по которому идём
+
+        template <bool>
+        friend class BasicIterator;
+        friend class dlist;
 
-        std::shared_ptr<DoubleNode<T>> newNode = std::make_shared<DoubleNode<T>>(value);
-        if (position == 0)
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T, T> *;
+        using reference = std::conditional_t<IsConst, const T, T> &;
+
+        BasicIterator() : ptr(nullptr), owner(nullptr) {}
+        BasicIterator(node *p, const dlist *list) : ptr(p), owner(list) {}
+
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst> &other) : ptr(other.ptr), owner(other.owner) {}
+
+        reference operator*() const { return ptr->value; } // разыменование: получаем значение
+        pointer operator->() const { return &ptr->value; }
+        reference get() const { return ptr->value; }       // альтернативный способ
+
+        // Префиксный инкремент: переходим к следующему узлу
+        BasicIterator &operator++()
         {
-            if (head != nullptr)
-            {
-                head->prev = newNode;
-                newNode->next = head;
-            }
-            head = newNode;
-            length++;
-            return;
+            if (ptr != nullptr)
+                ptr = ptr->next.get(); // .get()-  получаем сырой указатель из shared_ptr
+            return *this;
         }
 
-        auto cur = head;
-        int cnt = 0;
-        while (cnt < position - 1)
+        BasicIterator operator++(int)
         {
-            cur = cur->next;
-            cnt++;
+            BasicIterator old = *this;
+            ++*this;
+            return old;
         }
 
-        newNode->next = cur->next;
-        if (newNode->next != nullptr)
+        // Префиксный декремент: переходим к предыдущему узлу (от end() - к последнему)
+        BasicIterator &operator--()
         {
-            newNode->next->prev = newNode;
+            if (ptr == nullptr)
+                ptr = owner->tail.get();
+            else
+                ptr = ptr->prev.lock().get(); // prev - weak_ptr: берём сырой указатель через lock()
+            return *this;
         }
-        newNode->prev = cur;
-        cur->next = newNode;
-        length++;
+
+        BasicIterator operator--(int)
+        {
+            BasicIterator old = *this;
+            --*this;
+            return old;
+        }
+
+        // Сравнение: нужно для условия цикла for (it != end())
+        friend bool operator==(const BasicIterator &a, const BasicIterator &b) { return a.ptr == b.ptr; }
+        friend bool operator!=(const BasicIterator &a, const BasicIterator &b) { return a.ptr != b.ptr; }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // Типы в стиле стандартной библиотеки
+    using value_type = T;
+    using allocator_type = Alloc;
+    using reference = T &;
+    using const_reference = const T &;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    // Начало итерации
+    Iterator begin() { return Iterator(head.get(), this); }
+    // Конец итерации (nullptr)
+    Iterator end() { return Iterator(nullptr, this); }
+
+    ConstIterator begin() const { return ConstIterator(head.get(), this); }
+    ConstIterator end() const { return ConstIterator(nullptr, this); }
+    ConstIterator cbegin() const { return ConstIterator(head.get(), this); }
+    ConstIterator cend() const { return ConstIterator(nullptr, this); }
+
+    // Заменяет содержимое элементами [first, last).
+    // Новая цепочка строится целиком до того, как старая будет удалена.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last)
+    {
+        dlist chain(first, last, get_allocator());
+        clear();
+        steal(chain);
     }
 
-    // Удаление по индексу
-    void erase(int position)
+    void assign(std::initializer_list<T> init)
     {
-        if (position >= length || position < 0)
+        assign(init.begin(), init.end());
+    }
+
+    // Добавление элементов [first, last) в конец
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            link_back(make_node(*first));
+        }
+    }
+
+    // Добавление в конец всех элементов диапазона (контейнера, initializer_list и т.п.)
+    template <typename Range>
+    void append_range(const Range &range)
+    {
+        using std::begin;
+        using std::end;
+        append_range(begin(range), end(range));
+    }
+
+    // Вставка элементов [first, last) перед позицией position.
+    // Узлы сначала собираются в отдельную цепочку, затем она вшивается в список
+    // целиком (splice): до позиции - один проход, каждая вставка - O(1).
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert_range(std::size_t position, InputIt first, InputIt last)
+    {
+        if (position > length)
             throw std::out_of_range("Index out of range");
 
-        if (position == 0)
+        dlist chain(first, last, get_allocator());
+        ConstIterator pos = position < length ? ConstIterator(node_at(position), this) : cend();
+        splice(pos, chain);
+    }
+
+    // Обратный обход: от tail к head по ссылкам prev
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+    // Вставка перед позицией pos за O(1): перемещение.
+    // Возвращает итератор на вставленный элемент.
+    Iterator insert(ConstIterator pos, T &&value)
+    {
+        return link_before(pos, make_node(std::move(value)));
+    }
+
+    // Вставка перед позицией pos за O(1): копирование
+    Iterator insert(ConstIterator pos, T &value)
+    {
+        return link_before(pos, make_node(value));
+    }
+
+    // Вставка перед позицией pos за O(1): элемент конструируется прямо в узле из args
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args &&...args)
+    {
+        return link_before(pos, make_node(std::forward<Args>(args)...));
+    }
+
+    // Удаление элемента в позиции pos за O(1).
+    // Возвращает итератор на элемент после удалённого.
+    Iterator erase(ConstIterator pos)
+    {
+        if (pos.ptr == nullptr)
+            throw std::out_of_range("Iterator out of range");
+
+        std::shared_ptr<DoubleNode<T>> &slot = owner_of(pos.ptr);
+        std::shared_ptr<DoubleNode<T>> victim = std::move(slot); // держим узел, пока перешиваем соседей
+        slot = victim->next;
+        if (slot != nullptr)
+            slot->prev = victim->prev;
+        else
+            tail = victim->prev.lock(); // удалили последний
+        length--;
+        return Iterator(slot.get(), this);
+    }
+
+    // Переносит узлы [first, last) из other (может быть этим же списком) перед pos.
+    // Узлы не копируются и не выделяются заново - перешиваются только ссылки на
+    // концах диапазона. Пересчёт size() стоит O(длины диапазона), если переносится
+    // часть другого списка; весь список или диапазон внутри своего - O(1).
+    void splice(ConstIterator pos, dlist &other, ConstIterator first, ConstIterator last)
+    {
+        if (first == last)
+            return;
+
+        std::size_t count = 0;
+        if (&other != this)
         {
-            if (head->next == nullptr)
-            {
-                head.reset(); // список стал пустым
-            }
+            if (first == other.cbegin() && last == other.cend())
+                count = other.length;
             else
-            {
-                auto newHead = head->next;
-                newHead->prev.reset(); // обрываем обратную ссылку
-                head = newHead;
-            }
-            length--;
-            return;
+                count = static_cast<std::size_t>(std::distance(first, last));
         }
 
-        // Ищем узел перед удаляемым
-        int cnt = 0;
-        auto cur = head;
-        while (cnt < position - 1)
+        std::shared_ptr<DoubleNode<T>> chainHead;
+        std::shared_ptr<DoubleNode<T>> chainTail;
+        other.unlink(first, last, chainHead, chainTail);
+        other.length -= count;
+
+        link_chain_before(pos, std::move(chainHead), std::move(chainTail));
+        length += count;
+    }
+
+    // Переносит весь other перед pos за O(1)
+    void splice(ConstIterator pos, dlist &other)
+    {
+        splice(pos, other, other.cbegin(), other.cend());
+    }
+
+    // Переносит один элемент it из other перед pos за O(1)
+    void splice(ConstIterator pos, dlist &other, ConstIterator it)
+    {
+        ConstIterator next = it;
+        ++next;
+        // Внутри своего списка элемент может уже стоять на месте. Для чужого
+        // списка сравнивать нельзя: end() здесь и итератор за последним в other
+        // оба пустые
+        if (&other == this && (pos == it || pos == next))
+            return;
+        splice(pos, other, it, next);
+    }
+
+    // Алгоритмы на перешивании узлов (list_algorithms.h): значения не копируются
+    // и не перемещаются, память не выделяется, итераторы остаются действительными.
+    // Цепочка перестраивается по next, затем ссылки prev и tail восстанавливаются
+    // одним проходом
+
+    // Устойчивая сортировка слиянием, O(N log N). Если comp бросит исключение,
+    // все элементы остаются в списке, но порядок не определён
+    template <typename Compare>
+    void sort(Compare comp)
+    {
+        tail.reset(); // второй владелец последнего узла не нужен, пока цепочка перестраивается
+        try
+        {
+            sort_chain(head, comp);
+        }
+        catch (...)
         {
-            cur = cur->next;
-            cnt++;
+            relink();
+            throw;
         }
+        relink();
+    }
+
+    void sort()
+    {
+        sort(std::less<>());
+    }
 
-        // Пропускаем удаляемый узел
-        cur->next = cur->next->next;
-        if (cur->next != nullptr)
+    // Сливает отсортированный other в этот (отсортированный) список за O(N + M);
+    // other становится пустым. При равных элементах свои идут раньше
+    template <typename Compare>
+    void merge(dlist &other, Compare comp)
+    {
+        if (&other == this)
+            return;
+        tail.reset();
+        other.tail.reset();
+        std::shared_ptr<DoubleNode<T>> merged;
+        try
         {
-            // Обновляем prev у нового следующего узла
-            cur->next->prev = cur;
+            merge_chains(head, other.head, merged, comp);
         }
-        length--;
+        catch (...)
+        {
+            *chain_end(merged) = std::move(head);
+            *chain_end(merged) = std::move(other.head);
+            head = std::move(merged);
+            length += other.length;
+            other.length = 0;
+            relink();
+            throw;
+        }
+        head = std::move(merged);
+        length += other.length;
+        other.length = 0;
+        relink();
     }
 
-    // Move-присваивание
-    dlist &operator=(dlist &&list)
+    void merge(dlist &other)
     {
-        if (this == &list)
-            return *this; // самоприсваивание
+        merge(other, std::less<>());
+    }
 
-        head = std::move(list.head);
-        length = list.length;
+    void merge(dlist &&other)
+    {
+        merge(other, std::less<>());
+    }
 
-        list.head = nullptr;
-        list.length = 0;
-        return *this;
+    // Обратный порядок элементов за O(N)
+    void reverse()
+    {
+        tail.reset();
+        reverse_chain(head);
+        relink();
     }
 
-    // Copy-присваивание: создаёт копию поэлементно
-    dlist &operator=(dlist &list)
+    // Удаляет элементы, для которых pred(value) истинно; возвращает их количество
+    template <typename Pred>
+    std::size_t remove_if(Pred pred)
     {
-        if (this == &list)
-            return *this;
+        return drop_nodes([this, &pred](std::shared_ptr<DoubleNode<T>> &removed, std::size_t &count)
+                          { extract_chain_if(head, pred, removed, count); });
+    }
 
-        // Очищаем текущий список
-        head.reset();
-        length = 0;
+    // Удаляет элементы, равные value (value может быть элементом этого же списка)
+    std::size_t remove(const T &value)
+    {
+        return remove_if([&value](const T &item) { return item == value; });
+    }
 
-        // Копируем все элементы
-        auto cur = list.head;
-        while (cur != nullptr)
+    // Удаляет подряд идущие повторы, оставляя первый из них (same(a, b) - "равны")
+    template <typename BinaryPred>
+    std::size_t unique(BinaryPred same)
+    {
+        return drop_nodes([this, &same](std::shared_ptr<DoubleNode<T>> &removed, std::size_t &count)
+                          { extract_chain_duplicates(head, same, removed, count); });
+    }
+
+    std::size_t unique()
+    {
+        return unique(std::equal_to<>());
+    }
+
+private:
+    // Восстанавливает prev всех узлов и tail по цепочке next
+    void relink()
+    {
+        const std::shared_ptr<DoubleNode<T>> *owner = nullptr; // владелец предыдущего узла
+        for (std::shared_ptr<DoubleNode<T>> *slot = &head; *slot != nullptr; slot = &(*slot)->next)
         {
-            push_back(cur->value); // используем существующий push_back
-            cur = cur->next;
+            if (owner != nullptr)
+                (*slot)->prev = *owner;
+            else
+                (*slot)->prev.reset();
+            owner = slot;
         }
-        return *this;
+        if (owner != nullptr)
+            tail = *owner;
+        else
+            tail.reset();
     }
 
-    // Простой итератор (поддерживает range-based for)
-    class Iterator
+    // Выполняет extract(removed, count), затем уничтожает вынутые узлы и
+    // восстанавливает length, prev и tail (в том числе при исключении из предиката)
+    template <typename Extract>
+    std::size_t drop_nodes(Extract extract)
     {
-        DoubleNode<T> *ptr; // сырой указатель на текущий узел
+        tail.reset();
+        std::shared_ptr<DoubleNode<T>> removed;
+        std::size_t count = 0;
+        try
+        {
+            extract(removed, count);
+        }
+        catch (...)
+        {
+            length -= count;
+            relink();
+            clear_chain(removed);
+            throw;
+        }
+        length -= count;
+        relink();
+        clear_chain(removed);
+        return count;
+    }
 
-    public:
-        Iterator(DoubleNode<T> *p) : ptr(p) {}
+    // shared_ptr, который владеет узлом node: next предыдущего узла или head
+    std::shared_ptr<DoubleNode<T>> &owner_of(const DoubleNode<T> *node)
+    {
+        std::shared_ptr<DoubleNode<T>> before = node->prev.lock();
+        return before != nullptr ? before->next : head;
+    }
 
-        T &operator*() { return ptr->value; } // разыменование: получаем значение
-        T &get() { return ptr->value; }       // альтернативный способ
+    // Цепляет готовый узел перед pos
+    Iterator link_before(ConstIterator pos, std::shared_ptr<DoubleNode<T>> newNode)
+    {
+        DoubleNode<T> *raw = newNode.get();
+        if (pos.ptr == nullptr)
+        {
+            link_back(std::move(newNode)); // перед end() - это в конец
+            return Iterator(raw, this);
+        }
 
-        // Префиксный инкремент: переходим к следующему узлу
-        Iterator &operator++()
+        DoubleNode<T> *next = const_cast<DoubleNode<T> *>(pos.ptr);
+        std::shared_ptr<DoubleNode<T>> &slot = owner_of(next);
+        newNode->prev = next->prev;
+        newNode->next = std::move(slot); // новый узел забирает владение next
+        next->prev = newNode;
+        slot = std::move(newNode);
+        length++;
+        return Iterator(raw, this);
+    }
+
+    // Вырезает узлы [first, last) в отдельную цепочку chainHead..chainTail (length не меняет)
+    void unlink(ConstIterator first, ConstIterator last,
+                std::shared_ptr<DoubleNode<T>> &chainHead, std::shared_ptr<DoubleNode<T>> &chainTail)
+    {
+        std::shared_ptr<DoubleNode<T>> &slot = owner_of(first.ptr);
+        std::shared_ptr<DoubleNode<T>> before = first.ptr->prev.lock();
+
+        chainHead = std::move(slot);
+        chainTail = last.ptr == nullptr ? tail : last.ptr->prev.lock();
+
+        // Закрываем дыру: узел перед диапазоном теперь владеет узлом last
+        slot = std::move(chainTail->next);
+        if (slot != nullptr)
+            slot->prev = before;
+        else
+            tail = before;
+        chainHead->prev.reset();
+    }
+
+    // Вставляет цепочку chainHead..chainTail перед pos (length не меняет)
+    void link_chain_before(ConstIterator pos, std::shared_ptr<DoubleNode<T>> chainHead,
+                           std::shared_ptr<DoubleNode<T>> chainTail)
+    {
+        if (pos.ptr == nullptr)
         {
-            if (ptr != nullptr)
-                ptr = ptr->next.get(); // .get()-  получаем сырой указатель из shared_ptr
-            return *this;
+            if (tail != nullptr)
+            {
+                chainHead->prev = tail;
+                tail->next = std::move(chainHead);
+            }
+            else
+            {
+                head = std::move(chainHead);
+            }
+            tail = std::move(chainTail);
+            return;
         }
 
-        // Сравнение: нужно для условия цикла for (it != end())
-        bool operator!=(const Iterator &other) { return ptr != other.ptr; }
-    };
+        DoubleNode<T> *next = const_cast<DoubleNode<T> *>(pos.ptr);
+        std::shared_ptr<DoubleNode<T>> &slot = owner_of(next);
+        chainHead->prev = next->prev;
+        chainTail->next = std::move(slot);
+        next->prev = chainTail;
+        slot = std::move(chainHead);
+    }
+};
 
-    // Начало итерации
-    Iterator begin() { return Iterator(head.get()); }
-    // Конец итерации (nullptr)
-    Iterator end() { return Iterator(nullptr); }
-};
\ No newline at end of file
+// Список с узлами из std::pmr::memory_resource (см. pmr::myvector)
+namespace pmr
+{
+    template <typename T>
+    using dlist = ::dlist<T, std::pmr::polymorphic_allocator<T>>;
+}
@@ -0,0 +1,726 @@
+#pragma once
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include "bounds_check.h"
+#include "write_buffer.h"
+#include "stats.h"
+
+// Индексированный список (indexed list): позиционный skip list.
+// Нижний уровень - обычный двусвязный список, а над ним лежат "экспресс-полосы":
+// у узла высоты h есть ссылки вперёд на уровнях 0..h-1, и каждая ссылка помнит
+// ширину - сколько позиций она перепрыгивает. Поиск позиции k спускается по
+// уровням сверху вниз, складывая ширины, поэтому operator[], insert и erase
+// по индексу стоят O(log N) в среднем, а не O(index), как у slist/dlist.
+// Интерфейс - как у dlist (индексы, push/pop, итераторы, диапазоны).
+template <typename T, typename Alloc = std::allocator<T>>
+class ilist
+{
+private:
+    // Максимум уровней: при вероятности подъёма 1/4 хватает на 4^16 элементов
+    static constexpr int maxLevel = 16;
+
+    struct SkipNode;
+
+    // Ссылка вперёд на одном уровне: следующий узел и расстояние до него в позициях
+    // (для next == nullptr ширина не используется и держится равной 0)
+    struct Link
+    {
+        SkipNode *next = nullptr;
+        std::size_t width = 0;
+    };
+
+    // Узел: значение, обратная ссылка нижнего уровня и массив ссылок высоты height
+    struct SkipNode
+    {
+        T value;
+        SkipNode *prev = nullptr;
+        Link *links = nullptr;
+        int height = 0;
+
+        template <typename... Args>
+        explicit SkipNode(std::in_place_t, Args &&...args) : value(std::forward<Args>(args)...) {}
+    };
+
+    using node_type = SkipNode;
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+    using link_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Link>;
+    using link_traits = std::allocator_traits<link_allocator>;
+
+    node_allocator alloc;     // аллокатор узлов (ссылки выделяются его перепривязанной копией)
+    Link headLinks[maxLevel]; // ссылки из начала списка (позиция 0) на каждом уровне
+    node_type *tail;          // последний элемент (nullptr если пуст)
+    int level;                // сколько уровней сейчас используется (не меньше 1)
+    std::size_t length;       // количество элементов
+    std::uint32_t seed;       // состояние генератора высот узлов
+
+    // Высота нового узла: уровень k достаётся с вероятностью 1/4^k
+    int random_height()
+    {
+        int height = 1;
+        while (height < maxLevel)
+        {
+            // xorshift32 - дешёвый генератор, качества здесь хватает с запасом
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            if ((seed & 3) != 0)
+                break;
+            height++;
+        }
+        return height;
+    }
+
+    // Создаёт узел случайной высоты; значение строится прямо в узле из args
+    template <typename... Args>
+    node_type *make_node(Args &&...args)
+    {
+        int height = random_height();
+        link_allocator linkAlloc(alloc);
+        Link *links = link_traits::allocate(linkAlloc, height);
+        node_type *raw;
+        try
+        {
+            raw = node_traits::allocate(alloc, 1);
+        }
+        catch (...)
+        {
+            link_traits::deallocate(linkAlloc, links, height);
+            throw;
+        }
+        try
+        {
+            node_traits::construct(alloc, raw, std::in_place, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(alloc, raw, 1);
+            link_traits::deallocate(linkAlloc, links, height);
+            throw;
+        }
+
+        for (int lvl = 0; lvl < height; ++lvl)
+            new (links + lvl) Link();
+        raw->links = links;
+        raw->height = height;
+        stats_alloc(container_kind::ilist, sizeof(node_type) + sizeof(Link) * height);
+        return raw;
+    }
+
+    // Уничтожает узел и возвращает память аллокатору
+    void destroy_node(node_type *node)
+    {
+        stats_free(container_kind::ilist, sizeof(node_type) + sizeof(Link) * node->height);
+        link_allocator linkAlloc(alloc);
+        link_traits::deallocate(linkAlloc, node->links, node->height);
+        node_traits::destroy(alloc, node);
+        node_traits::deallocate(alloc, node, 1);
+    }
+
+    // Ссылки узла node (nullptr - начало списка)
+    Link *links_of(node_type *node)
+    {
+        return node != nullptr ? node->links : headLinks;
+    }
+
+    const Link *links_of(node_type *node) const
+    {
+        return node != nullptr ? node->links : headLinks;
+    }
+
+    // Забирает узлы другого списка (свой список должен быть пуст)
+    void steal(ilist &list)
+    {
+        for (int lvl = 0; lvl < maxLevel; ++lvl)
+        {
+            headLinks[lvl] = list.headLinks[lvl];
+            list.headLinks[lvl] = Link();
+        }
+        tail = list.tail;
+        level = list.level;
+        length = list.length;
+
+        list.tail = nullptr;
+        list.level = 1;
+        list.length = 0;
+    }
+
+    // Предшественники позиции position на каждом уровне: update[lvl] - последний
+    // узел уровня lvl, стоящий не дальше позиции position (nullptr - начало списка),
+    // rank[lvl] - его позиция. Элементы нумеруются с 1, начало списка - позиция 0.
+    void find_before(std::size_t position, node_type **update, std::size_t *rank)
+    {
+        node_type *cur = nullptr;
+        std::size_t pos = 0;
+        std::size_t steps = 0; // для статистики
+        for (int lvl = level - 1; lvl >= 0; --lvl)
+        {
+            Link *links = links_of(cur);
+            while (links[lvl].next != nullptr && pos + links[lvl].width <= position)
+            {
+                pos += links[lvl].width;
+                cur = links[lvl].next;
+                links = cur->links;
+                ++steps;
+            }
+            update[lvl] = cur;
+            rank[lvl] = pos;
+        }
+        stats_walk(container_kind::ilist, steps);
+    }
+
+    // Узел с номером index (0 <= index < length) за O(log N)
+    node_type *node_at(std::size_t index) const
+    {
+        node_type *cur = nullptr;
+        std::size_t pos = 0;
+        const std::size_t target = index + 1;
+        std::size_t steps = 0; // для статистики
+        for (int lvl = level - 1; lvl >= 0; --lvl)
+        {
+            const Link *links = links_of(cur);
+            while (links[lvl].next != nullptr && pos + links[lvl].width <= target)
+            {
+                pos += links[lvl].width;
+                cur = links[lvl].next;
+                links = cur->links;
+                ++steps;
+            }
+            if (pos == target)
+                break;
+        }
+        stats_walk(container_kind::ilist, steps);
+        return cur;
+    }
+
+    // Вставляет готовый узел так, чтобы он стал элементом с номером position
+    void link_at(node_type *newNode, std::size_t position)
+    {
+        node_type *update[maxLevel];
+        std::size_t rank[maxLevel];
+        find_before(position, update, rank);
+
+        int height = newNode->height;
+        for (int lvl = level; lvl < height; ++lvl)
+        {
+            // Новые уровни начинаются с начала списка и пока никуда не ведут
+            update[lvl] = nullptr;
+            rank[lvl] = 0;
+            headLinks[lvl] = Link();
+        }
+        if (height > level)
+            level = height;
+
+        for (int lvl = 0; lvl < level; ++lvl)
+        {
+            Link &before = links_of(update[lvl])[lvl];
+            if (lvl < height)
+            {
+                // Ссылка предшественника делится новым узлом на две
+                Link &own = newNode->links[lvl];
+                own.next = before.next;
+                own.width = own.next != nullptr ? before.width - (position - rank[lvl]) : 0;
+                before.next = newNode;
+                before.width = position + 1 - rank[lvl];
+            }
+            else if (before.next != nullptr)
+            {
+                before.width++; // ссылка перепрыгивает на одну позицию больше
+            }
+        }
+
+        newNode->prev = update[0];
+        if (newNode->links[0].next != nullptr)
+            newNode->links[0].next->prev = newNode;
+        else
+            tail = newNode;
+        length++;
+    }
+
+    // Вырезает и уничтожает элемент с номером position
+    void unlink_at(std::size_t position)
+    {
+        node_type *update[maxLevel];
+        std::size_t rank[maxLevel];
+        find_before(position, update, rank);
+
+        node_type *victim = headLinks[0].next;
+        if (update[0] != nullptr)
+            victim = update[0]->links[0].next;
+
+        for (int lvl = 0; lvl < level; ++lvl)
+        {
+            Link &before = links_of(update[lvl])[lvl];
+            if (before.next == victim)
+            {
+                // Ссылка предшественника сливается со ссылкой удаляемого узла
+                const Link &own = victim->links[lvl];
+                before.next = own.next;
+                before.width = own.next != nullptr ? before.width + own.width - 1 : 0;
+            }
+            else if (before.next != nullptr)
+            {
+                before.width--;
+            }
+        }
+
+        if (victim->links[0].next != nullptr)
+            victim->links[0].next->prev = victim->prev;
+        else
+            tail = victim->prev;
+
+        while (level > 1 && headLinks[level - 1].next == nullptr)
+            level--;
+
+        destroy_node(victim);
+        length--;
+    }
+
+public:
+    // Конструктор пустого списка
+    ilist() : ilist(Alloc()) {}
+
+    // Пустой список, узлы которого будут выделяться через allocator
+    explicit ilist(const Alloc &allocator) : alloc(allocator)
+    {
+        tail = nullptr;
+        level = 1;
+        length = 0;
+        seed = 0x9E3779B9u;
+    }
+
+    // Список из списка инициализации
+    ilist(std::initializer_list<T> init, const Alloc &allocator = Alloc()) : ilist(allocator)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    // Список из диапазона итераторов [first, last)
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    ilist(InputIt first, InputIt last, const Alloc &allocator = Alloc()) : ilist(allocator)
+    {
+        append_range(first, last);
+    }
+
+    // Move-конструктор: "перехватывает" узлы (и аллокатор) из другого списка
+    ilist(ilist &&list) : alloc(std::move(list.alloc))
+    {
+        seed = list.seed;
+        steal(list);
+    }
+
+    // Деструктор: список - единственный владелец, поэтому удаляет узлы сам
+    ~ilist()
+    {
+        clear();
+    }
+
+    // Аллокатор, которым список выделяет узлы
+    Alloc get_allocator() const
+    {
+        return Alloc(alloc);
+    }
+
+    // Удаляет все элементы: обход по нижнему уровню
+    void clear()
+    {
+        node_type *cur = headLinks[0].next;
+        while (cur != nullptr)
+        {
+            node_type *next = cur->links[0].next;
+            destroy_node(cur);
+            cur = next;
+        }
+        for (Link &link : headLinks)
+            link = Link();
+        tail = nullptr;
+        level = 1;
+        length = 0;
+    }
+
+    // Вставка в конец: версия для lvalue (копирование)
+    void push_back(T &value)
+    {
+        emplace(length, value);
+    }
+
+    // Вставка в конец: версия для rvalue (перемещение)
+    void push_back(T &&value)
+    {
+        emplace(length, std::move(value));
+    }
+
+    // Вставка в конец: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        return emplace(length, std::forward<Args>(args)...);
+    }
+
+    // Вставка в начало: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return emplace(0, std::forward<Args>(args)...);
+    }
+
+    // Вставка в начало: версия для lvalue (копирование)
+    void push_front(T &value)
+    {
+        insert(value, 0);
+    }
+
+    // Вставка в начало: версия для rvalue (перемещение)
+    void push_front(T &&value)
+    {
+        insert(std::move(value), 0);
+    }
+
+    // Удаление первого элемента
+    void pop_front()
+    {
+        if (length == 0)
+            throw std::out_of_range("List is empty");
+        erase(0);
+    }
+
+    // Первый элемент за O(1). Пустой список проверяется только при LAB3_BOUNDS_CHECK
+    T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return headLinks[0].next->value;
+    }
+
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return headLinks[0].next->value;
+    }
+
+    // Последний элемент за O(1)
+    T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
+    }
+
+    // Простой вывод списка
+    void print() const
+    {
+        print_range(begin(), end());
+    }
+
+    // Вывод элементов через separator: текст копится в буфере и уходит в поток
+    // блоками по write_chunk_size байт, числа форматируются std::to_chars
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Потоковый режим: готовые блоки текста передаются в sink(const char *data, std::size_t size)
+    // по мере заполнения буфера - весь вывод целиком в памяти не собирается
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Возвращает текущую длину
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    // Пуст ли список
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Вставка в произвольную позицию за O(log N): элемент конструируется прямо в узле из args.
+    // Возвращает ссылку на вставленный элемент.
+    template <typename... Args>
+    T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+        node_type *newNode = make_node(std::forward<Args>(args)...);
+        link_at(newNode, position);
+        return newNode->value;
+    }
+
+    // Вставка в произвольную позицию: перемещение
+    void insert(T &&value, std::size_t position)
+    {
+        emplace(position, std::move(value));
+    }
+
+    // Вставка в произвольную позицию: копирование
+    void insert(T &value, std::size_t position)
+    {
+        emplace(position, value);
+    }
+
+    // Удаление по индексу за O(log N)
+    void erase(std::size_t position)
+    {
+        if (position >= length)
+            throw std::out_of_range("Index out of range");
+        unlink_at(position);
+    }
+
+    // Move-присваивание
+    ilist &operator=(ilist &&list)
+    {
+        if (this == &list)
+            return *this;
+
+        clear();
+
+        if constexpr (node_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc = list.alloc; // аллокатор уходит вместе с узлами
+        }
+        else if (!(alloc == list.alloc))
+        {
+            // Узлы другого аллокатора освобождать нельзя - перемещаем значения в свои узлы
+            for (T &value : list)
+            {
+                emplace(length, std::move(value));
+            }
+            list.clear();
+            return *this;
+        }
+
+        steal(list);
+        return *this;
+    }
+
+    // Copy-присваивание: создаёт копию поэлементно
+    ilist &operator=(ilist &list)
+    {
+        if (this == &list)
+            return *this;
+
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value)
+        {
+            alloc = list.alloc;
+        }
+
+        for (T &value : list)
+        {
+            emplace(length, value);
+        }
+        return *this;
+    }
+
+    // Двунаправленный итератор по нижнему уровню. Кроме узла хранит список-владелец:
+    // end() - это nullptr, и шаг назад от него должен попасть в tail.
+    // IsConst = true - только для чтения.
+    template <bool IsConst>
+    class BasicIterator
+    {
+        using node = std::conditional_t<IsConst, const node_type, node_type>;
+
+        node *ptr;          // текущий узел (nullptr - конец)
+        const ilist *owner; // список, по которому идём
+
+        template <bool>
+        friend class BasicIterator;
+        friend class ilist;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T, T> *;
+        using reference = std::conditional_t<IsConst, const T, T> &;
+
+        BasicIterator() : ptr(nullptr), owner(nullptr) {}
+        BasicIterator(node *p, const ilist *list) : ptr(p), owner(list) {}
+
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst> &other) : ptr(other.ptr), owner(other.owner) {}
+
+        reference operator*() const { return ptr->value; }
+        pointer operator->() const { return &ptr->value; }
+        reference get() const { return ptr->value; }
+
+        // Префиксный инкремент: переходим к следующему узлу нижнего уровня
+        BasicIterator &operator++()
+        {
+            if (ptr != nullptr)
+                ptr = ptr->links[0].next;
+            return *this;
+        }
+
+        BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        // Префиксный декремент: переходим к предыдущему узлу (от end() - к последнему)
+        BasicIterator &operator--()
+        {
+            if (ptr == nullptr)
+                ptr = owner->tail;
+            else
+                ptr = ptr->prev;
+            return *this;
+        }
+
+        BasicIterator operator--(int)
+        {
+            BasicIterator old = *this;
+            --*this;
+            return old;
+        }
+
+        friend bool operator==(const BasicIterator &a, const BasicIterator &b) { return a.ptr == b.ptr; }
+        friend bool operator!=(const BasicIterator &a, const BasicIterator &b) { return a.ptr != b.ptr; }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // Типы в стиле стандартной библиотеки
+    using value_type = T;
+    using allocator_type = Alloc;
+    using reference = T &;
+    using const_reference = const T &;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    // Начало итерации
+    Iterator begin() { return Iterator(headLinks[0].next, this); }
+    // Конец итерации (nullptr)
+    Iterator end() { return Iterator(nullptr, this); }
+
+    ConstIterator begin() const { return ConstIterator(headLinks[0].next, this); }
+    ConstIterator end() const { return ConstIterator(nullptr, this); }
+    ConstIterator cbegin() const { return ConstIterator(headLinks[0].next, this); }
+    ConstIterator cend() const { return ConstIterator(nullptr, this); }
+
+    // Обратный обход: от tail к началу по ссылкам prev
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+    // Заменяет содержимое элементами [first, last).
+    // Новый список строится целиком до того, как старый будет удалён.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last)
+    {
+        ilist chain(first, last, get_allocator());
+        clear();
+        steal(chain);
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    // Добавление элементов [first, last) в конец
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            emplace(length, *first);
+        }
+    }
+
+    // Добавление в конец всех элементов диапазона (контейнера, initializer_list и т.п.)
+    template <typename Range>
+    void append_range(const Range &range)
+    {
+        using std::begin;
+        using std::end;
+        append_range(begin(range), end(range));
+    }
+
+    // Вставка элементов [first, last) перед позицией position: O(log N) на элемент
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert_range(std::size_t position, InputIt first, InputIt last)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+
+        for (; first != last; ++first, ++position)
+        {
+            emplace(position, *first);
+        }
+    }
+};
+
+// Список с узлами из std::pmr::memory_resource (см. pmr::myvector)
+namespace pmr
+{
+    template <typename T>
+    using ilist = ::ilist<T, std::pmr::polymorphic_allocator<T>>;
+}
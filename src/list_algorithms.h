@@ -0,0 +1,190 @@
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+// Алгоритмы над цепочкой узлов списка, связанной владеющими указателями next
+// (unique_ptr у slist, shared_ptr у dlist). Ptr - тип такого указателя; узел
+// хранит value и next. Цепочка задаётся указателем на первый узел (Ptr &head).
+//
+// Узлы только перешиваются: ничего не выделяется, значения не копируются и не
+// перемещаются, итераторы и ссылки на элементы остаются действительными.
+// Обратные ссылки (prev у dlist) и tail алгоритмы не трогают - их
+// восстанавливает сам список.
+//
+// Исключение из comp/pred не теряет узлов: каждый узел остаётся ровно в одной
+// из цепочек, которые видит вызывающий код, и тот собирает их обратно.
+
+// Слот последнего узла цепочки (его next), для пустой цепочки - сам head
+template <typename Ptr>
+Ptr *chain_end(Ptr &head)
+{
+    Ptr *slot = &head;
+    while (*slot != nullptr)
+        slot = &(*slot)->next;
+    return slot;
+}
+
+// Последний узел цепочки (nullptr для пустой)
+template <typename Ptr>
+auto chain_last(Ptr &head) -> decltype(head.get())
+{
+    auto *last = head.get();
+    if (last == nullptr)
+        return nullptr;
+    while (last->next != nullptr)
+        last = last->next.get();
+    return last;
+}
+
+// Уничтожает цепочку по одному узлу, без рекурсии деструкторов next.
+// next забирается до уничтожения узла: присваивание unique_ptr сначала удаляет
+// старый узел, а удалитель с состоянием копирует уже потом - из источника в этом узле
+template <typename Ptr>
+void clear_chain(Ptr &head)
+{
+    while (head != nullptr)
+    {
+        Ptr next = std::move(head->next);
+        head = std::move(next);
+    }
+}
+
+// Сливает отсортированные цепочки a и b в пустую out; устойчиво - при равных
+// значениях первыми идут узлы a. При исключении из comp узлы лежат в a, b и out
+template <typename Ptr, typename Compare>
+void merge_chains(Ptr &a, Ptr &b, Ptr &out, Compare &comp)
+{
+    Ptr *slot = &out;
+    while (a != nullptr && b != nullptr)
+    {
+        Ptr &from = comp(b->value, a->value) ? b : a;
+        *slot = std::move(from);
+        from = std::move((*slot)->next);
+        slot = &(*slot)->next;
+    }
+    *slot = std::move(a != nullptr ? a : b);
+}
+
+// Устойчивая сортировка слиянием снизу вверх, O(N log N) сравнений и O(1) памяти:
+// bins[i] - уже отсортированная цепочка из 2^i узлов (или пустая). Очередной
+// узел сливается с занятыми младшими корзинами, как перенос при сложении единицы.
+// При исключении из comp все узлы собираются обратно в head в произвольном порядке.
+template <typename Ptr, typename Compare>
+void sort_chain(Ptr &head, Compare &comp)
+{
+    constexpr std::size_t maxBins = 64; // 2^64 узлов в памяти не поместится
+    Ptr bins[maxBins];
+    Ptr rest = std::move(head);
+    Ptr carry;
+    Ptr merged;
+    std::size_t used = 0;
+
+    try
+    {
+        while (rest != nullptr)
+        {
+            carry = std::move(rest);
+            rest = std::move(carry->next);
+
+            std::size_t i = 0;
+            for (; i < used && bins[i] != nullptr; ++i)
+            {
+                merge_chains(bins[i], carry, merged, comp); // bins[i] - более ранние узлы
+                carry = std::move(merged);
+            }
+            bins[i] = std::move(carry);
+            if (i == used)
+                used++;
+        }
+
+        // В старших корзинах - более ранние узлы
+        for (std::size_t i = 0; i < used; ++i)
+        {
+            merge_chains(bins[i], carry, merged, comp);
+            carry = std::move(merged);
+        }
+        head = std::move(carry);
+    }
+    catch (...)
+    {
+        Ptr *slot = &head;
+        for (Ptr *piece : {&merged, &carry, &rest})
+        {
+            *slot = std::move(*piece);
+            slot = chain_end(*slot);
+        }
+        for (std::size_t i = 0; i < used; ++i)
+        {
+            *slot = std::move(bins[i]);
+            slot = chain_end(*slot);
+        }
+        throw;
+    }
+}
+
+// Разворачивает цепочку
+template <typename Ptr>
+void reverse_chain(Ptr &head)
+{
+    Ptr done;
+    while (head != nullptr)
+    {
+        Ptr next = std::move(head->next);
+        head->next = std::move(done);
+        done = std::move(head);
+        head = std::move(next);
+    }
+    head = std::move(done);
+}
+
+// Переносит узлы, для которых pred(value) истинно, в конец цепочки removed
+// (по одному, сразу же увеличивая count). Значение, с которым сравнивает pred,
+// может лежать в удаляемом узле: узлы уничтожает вызывающий код после обхода
+template <typename Ptr, typename Pred>
+void extract_chain_if(Ptr &head, Pred &pred, Ptr &removed, std::size_t &count)
+{
+    Ptr *removedEnd = chain_end(removed);
+    Ptr *slot = &head;
+    while (*slot != nullptr)
+    {
+        if (pred((*slot)->value))
+        {
+            *removedEnd = std::move(*slot);
+            *slot = std::move((*removedEnd)->next);
+            removedEnd = &(*removedEnd)->next;
+            count++;
+        }
+        else
+        {
+            slot = &(*slot)->next;
+        }
+    }
+}
+
+// То же для подряд идущих повторов: узел уходит в removed, если
+// same(оставленный перед ним, его значение) истинно
+template <typename Ptr, typename BinaryPred>
+void extract_chain_duplicates(Ptr &head, BinaryPred &same, Ptr &removed, std::size_t &count)
+{
+    if (head == nullptr)
+        return;
+    Ptr *removedEnd = chain_end(removed);
+    auto *kept = head.get();
+    Ptr *slot = &head->next;
+    while (*slot != nullptr)
+    {
+        if (same(kept->value, (*slot)->value))
+        {
+            *removedEnd = std::move(*slot);
+            *slot = std::move((*removedEnd)->next);
+            removedEnd = &(*removedEnd)->next;
+            count++;
+        }
+        else
+        {
+            kept = slot->get();
+            slot = &(*slot)->next;
+        }
+    }
+}
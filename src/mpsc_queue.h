@@ -0,0 +1,196 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+#include <limits>
+
+// Узел очереди: как Node из slist, только ссылка на следующий узел атомарная,
+// а значение лежит в сырой памяти - у фиктивного узла (stub) значения нет.
+template <typename T>
+struct QueueNode
+{
+    std::atomic<QueueNode *> next{nullptr}; // следующий узел (пишет производитель, читает потребитель)
+
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    // Узел без значения (фиктивный)
+    QueueNode() {}
+
+    // Узел со значением, построенным прямо в узле из args
+    template <typename... Args>
+    explicit QueueNode(std::in_place_t, Args &&...args)
+    {
+        ::new (static_cast<void *>(storage)) T(std::forward<Args>(args)...);
+    }
+
+    T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+};
+
+// Размер кэш-линии: голова и хвост очереди лежат в разных линиях, чтобы
+// производители, меняющие хвост, не сбрасывали кэш потребителю (false sharing)
+constexpr std::size_t queue_cache_line = 64;
+
+// Lock-free очередь "много производителей - один потребитель" (MPSC) на
+// односвязном списке узлов (схема Д. Вьюкова с фиктивным узлом).
+//
+// push()/emplace() можно вызывать из любого числа потоков одновременно: вставка -
+// это один atomic exchange хвоста и одна запись ссылки, без циклов повтора и
+// блокировок. try_pop()/drain() и деструктор - только из одного потока-потребителя.
+// Узлы освобождает только потребитель, и лишь после того, как производитель
+// дописал ссылку на следующий узел, поэтому hazard pointers и эпохи не нужны:
+// ни один поток не может обратиться к уже освобождённому узлу.
+//
+// Аллокатор вызывается из потоков-производителей конкурентно и должен быть
+// потокобезопасным (std::allocator подходит, pool_allocator из node_pool.h - нет).
+template <typename T, typename Alloc = std::allocator<T>>
+class mpsc_queue
+{
+private:
+    using node_type = QueueNode<T>;
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc; // аллокатор узлов
+
+    // Хвост: последний добавленный узел, меняют производители
+    alignas(queue_cache_line) std::atomic<node_type *> tail;
+    // Голова: фиктивный узел перед первым элементом, меняет только потребитель
+    alignas(queue_cache_line) node_type *head;
+
+    // Создаёт узел через аллокатор очереди: без аргументов - фиктивный,
+    // с std::in_place и args - со значением
+    template <typename... Args>
+    node_type *make_node(Args &&...args)
+    {
+        node_type *raw = node_traits::allocate(alloc, 1);
+        try
+        {
+            node_traits::construct(alloc, raw, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(alloc, raw, 1);
+            throw;
+        }
+        return raw;
+    }
+
+    // Возвращает память узла аллокатору (значение уже уничтожено)
+    void free_node(node_type *node)
+    {
+        node_traits::destroy(alloc, node);
+        node_traits::deallocate(alloc, node, 1);
+    }
+
+    // Присоединяет готовый узел в хвост: exchange публикует узел производителям,
+    // store(release) - потребителю вместе со значением
+    void link_back(node_type *node)
+    {
+        node_type *prev = tail.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    // Пустая очередь: голова и хвост указывают на фиктивный узел
+    explicit mpsc_queue(const Alloc &allocator = Alloc()) : alloc(allocator)
+    {
+        node_type *stub = make_node();
+        head = stub;
+        tail.store(stub, std::memory_order_relaxed);
+    }
+
+    // Узлы и атомарные указатели не копируются и не переносятся
+    mpsc_queue(const mpsc_queue &) = delete;
+    mpsc_queue &operator=(const mpsc_queue &) = delete;
+
+    // Деструктор (в потоке-потребителе, когда производители закончили)
+    ~mpsc_queue()
+    {
+        clear();
+        free_node(head);
+    }
+
+    Alloc get_allocator() const
+    {
+        return Alloc(alloc);
+    }
+
+    // Добавление в хвост (из любого потока)
+    void push(const T &value)
+    {
+        link_back(make_node(std::in_place, value));
+    }
+
+    void push(T &&value)
+    {
+        link_back(make_node(std::in_place, std::move(value)));
+    }
+
+    // Добавление в хвост, элемент конструируется прямо в узле из args (из любого потока)
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+        link_back(make_node(std::in_place, std::forward<Args>(args)...));
+    }
+
+    // Извлечение из головы (только потребитель). false, если очередь пуста -
+    // или производитель уже занял хвост, но ещё не дописал ссылку: такой элемент
+    // станет виден при следующем вызове
+    bool try_pop(T &out)
+    {
+        node_type *next = head->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            return false;
+
+        // Если перемещение бросит исключение, элемент останется в очереди
+        T *value = next->value();
+        out = std::move(*value);
+        std::destroy_at(value);
+
+        // next становится новым фиктивным узлом, старый освобождаем
+        free_node(head);
+        head = next;
+        return true;
+    }
+
+    // Пакетное извлечение (только потребитель): передаёт в sink не больше limit
+    // элементов подряд, без промежуточной копии. Возвращает число извлечённых
+    template <typename Sink>
+    std::size_t drain(Sink &&sink, std::size_t limit = std::numeric_limits<std::size_t>::max())
+    {
+        std::size_t count = 0;
+        while (count < limit)
+        {
+            node_type *next = head->next.load(std::memory_order_acquire);
+            if (next == nullptr)
+                break;
+
+            T *value = next->value();
+            sink(std::move(*value));
+            std::destroy_at(value);
+
+            free_node(head);
+            head = next;
+            ++count;
+        }
+        return count;
+    }
+
+    // Удаляет все видимые потребителю элементы (только потребитель)
+    void clear()
+    {
+        drain([](T &&) {});
+    }
+
+    // Пуста ли очередь с точки зрения потребителя (только потребитель)
+    bool empty() const
+    {
+        return head->next.load(std::memory_order_acquire) == nullptr;
+    }
+};
@@ -4,155 +4,840 @@
 #include <iostream>
 #include <utility>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
+#include <initializer_list>
+#include "bounds_check.h"
+#include "write_buffer.h"
+#include "stats.h"
+#include "simd.h"
 
-// Простой вектор на основе динамического массива и unique_ptr<T[]>.
+// Политики роста ёмкости myvector (третий параметр шаблона).
+// next(capacity, required, elementSize) - новая ёмкость, когда текущей capacity
+// не хватает на required элементов размером elementSize байт; не меньше required.
+
+// Рост в 2 раза: меньше всего перевыделений
+struct growth_2x
+{
+    static std::size_t next(std::size_t capacity, std::size_t required, std::size_t)
+    {
+        return std::max(required, capacity * 2);
+    }
+};
+
+// Рост в 1.5 раза: освобождённые раньше блоки суммарно успевают вместить новый,
+// и аллокатор может переиспользовать память вместо того, чтобы брать новую
+struct growth_1_5x
+{
+    static std::size_t next(std::size_t capacity, std::size_t required, std::size_t)
+    {
+        return std::max(required, capacity + capacity / 2);
+    }
+};
+
+// Для больших буферов: рост в 2 раза, но от 2 МиБ размер массива округляется вверх
+// до целых huge-страниц. Такие блоки malloc отдаёт через mmap, и realloc растит
+// их перестановкой страниц (mremap), а не копированием
+struct growth_huge_page
+{
+    static constexpr std::size_t pageBytes = std::size_t(2) * 1024 * 1024;
+
+    static std::size_t next(std::size_t capacity, std::size_t required, std::size_t elementSize)
+    {
+        std::size_t count = std::max(required, capacity * 2);
+        std::size_t bytes = count * elementSize;
+        if (bytes < pageBytes)
+            return count;
+        bytes = (bytes + pageBytes - 1) / pageBytes * pageBytes;
+        return bytes / elementSize;
+    }
+};
+
+// Выровненный массив: политика Base, но массив выделяется по границе Align байт
+// (например, 64 - строка кэша и вектор AVX-512), см. aligned_myvector
+template <std::size_t Align, typename Base = growth_2x>
+struct aligned_to : Base
+{
+    static_assert(Align > 0 && (Align & (Align - 1)) == 0, "alignment must be a power of two");
+    static constexpr std::size_t alignment = Align;
+};
+
+// Выравнивание, которое требует политика роста (1, если не требует никакого)
+template <typename Growth, typename = void>
+struct growth_alignment
+{
+    static constexpr std::size_t value = 1;
+};
+
+template <typename Growth>
+struct growth_alignment<Growth, std::void_t<decltype(Growth::alignment)>>
+{
+    static constexpr std::size_t value = Growth::alignment;
+};
+
+// Встроенный буфер вектора: N ячеек сырой памяти прямо внутри объекта
+template <typename T, std::size_t N, std::size_t Align = alignof(T)>
+struct InlineBuffer
+{
+    alignas(Align) unsigned char storage[sizeof(T) * N];
+
+    // Пользовательский конструктор: иначе value-инициализация обнуляла бы storage
+    InlineBuffer() {}
+
+    T *inline_data() { return reinterpret_cast<T *>(storage); }
+};
+
+// Без встроенного буфера - пустая база: обычный myvector не становится больше
+template <typename T, std::size_t Align>
+struct InlineBuffer<T, 0, Align>
+{
+    T *inline_data() { return nullptr; }
+};
+
+// Аллокатор вектора - тоже база: аллокатор без состояния (std::allocator)
+// не увеличивает размер вектора
+template <typename Alloc>
+struct AllocatorBase : Alloc
+{
+    AllocatorBase() = default;
+    explicit AllocatorBase(const Alloc &source) : Alloc(source) {}
+
+    Alloc &allocator() { return *this; }
+    const Alloc &allocator() const { return *this; }
+};
+
+// Простой вектор на основе динамического массива.
+// Память выделяется "сырой" (без конструирования элементов): объекты создаются
+// placement new только в занятых ячейках [0, length) и уничтожаются вручную.
 // Поддерживает автоматическое расширение, вставку, удаление и итерацию.
-template <typename T>
-class myvector
+//
+// Inline > 0 - оптимизация малого буфера (см. small_myvector): первые Inline
+// элементов живут внутри самого объекта, и куча не используется, пока вектор
+// не вырастет больше Inline. Growth - политика роста ёмкости (growth_2x,
+// growth_1_5x, growth_huge_page); aligned_to<Align, Base> дополнительно
+// выравнивает массив по Align байт.
+//
+// Тривиально копируемые T (char, uint8_t, POD-структуры) хранятся в памяти
+// malloc и растут через realloc: большой блок обычно расширяется на месте или
+// перестановкой страниц, без физического копирования элементов.
+//
+// Alloc - аллокатор массива по модели стандартной библиотеки (allocator_traits,
+// propagate_on_container_*): например, std::pmr::polymorphic_allocator с
+// monotonic_buffer_resource (см. pmr::myvector). Память массива берётся только
+// у него; malloc/realloc - лишь для std::allocator. Элементы конструируются в
+// этой памяти как обычно, аллокатор им не передаётся - так же, как в списках.
+template <typename T, std::size_t Inline = 0, typename Growth = growth_2x, typename Alloc = std::allocator<T>>
+class myvector : private InlineBuffer<T, Inline, std::max(alignof(T), growth_alignment<Growth>::value)>,
+                 private AllocatorBase<typename std::allocator_traits<Alloc>::template rebind_alloc<T>>
 {
 private:
-    std::unique_ptr<T[]> data; // владеющий указатель на динамический массив
-    int capacity = 1;          // текущий размер выделенной памяти (макс. элементов, которые можно хранить без realloc)
-    int length = 0;            // количество реально занятых элементов
+    using allocator_base = AllocatorBase<typename std::allocator_traits<Alloc>::template rebind_alloc<T>>;
+    using array_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    using alloc_traits = std::allocator_traits<array_allocator>;
+
+    // Память массива выделяет стандартный аллокатор: можно malloc/realloc и выровненный new
+    static constexpr bool default_allocator = std::is_same<array_allocator, std::allocator<T>>::value;
+
+    // Выравнивание массива: не меньше alignof(T) и требования политики роста
+    static constexpr std::size_t alignment = std::max(alignof(T), growth_alignment<Growth>::value);
+    static_assert(default_allocator || alignment == alignof(T),
+                  "aligned_to needs std::allocator: a custom allocator decides the alignment itself");
+
+    T *buffer = this->inline_data(); // массив элементов: встроенный буфер или память из кучи
+    std::size_t reserved = Inline;   // текущий размер массива (макс. элементов, которые можно хранить без realloc)
+    std::size_t length = 0;          // количество реально занятых элементов
+
+    // Элементы можно переносить побайтно, а значит и растить массив через realloc
+    // (malloc выравнивает не сильнее max_align_t, а realloc не сохраняет большего выравнивания)
+    static constexpr bool use_realloc =
+        default_allocator && std::is_trivially_copyable<T>::value && alignment <= alignof(std::max_align_t);
 
-    // Увеличивает ёмкость в 2 раз и копирует старые данные в новый массив
-    void resize()
+    // Размер count элементов в байтах
+    static std::size_t bytes(std::size_t count)
     {
-        capacity *= 2;
-        std::unique_ptr<T[]> newData(new T[capacity]); // новый массив
-        // Копируем существующие переменные
-        for (int i = 0; i < length; ++i)
+        return sizeof(T) * count;
+    }
+
+    // Выделяет сырую память под count элементов (без вызова конструкторов)
+    T *allocate(std::size_t count)
+    {
+        if (count == 0)
+            return nullptr;
+        if (count > max_size())
+            throw std::length_error("myvector is too long");
+        if constexpr (use_realloc)
+        {
+            void *raw = std::malloc(bytes(count));
+            if (raw == nullptr)
+                throw std::bad_alloc();
+            stats_alloc(container_kind::myvector, bytes(count));
+            return static_cast<T *>(raw);
+        }
+        else if constexpr (!default_allocator)
+        {
+            T *raw = alloc_traits::allocate(this->allocator(), count);
+            stats_alloc(container_kind::myvector, bytes(count));
+            return raw;
+        }
+        else if constexpr (alignment > alignof(T))
+        {
+            void *raw = ::operator new(bytes(count), std::align_val_t(alignment));
+            stats_alloc(container_kind::myvector, bytes(count));
+            return static_cast<T *>(raw);
+        }
+        else
         {
-            newData[i] = data[i];
+            T *raw = std::allocator<T>().allocate(count);
+            stats_alloc(container_kind::myvector, bytes(count));
+            return raw;
         }
-        data = std::move(newData); // передаём владение новым массивом
     }
 
-public:
-    // Конструктор по умолчанию: выделяет массив из 1 элемента
-    myvector()
+    // Освобождает сырую память (элементы к этому моменту должны быть уничтожены).
+    // Встроенный буфер не освобождается.
+    void deallocate(T *ptr, std::size_t count)
     {
-        capacity = 1;
+        if (ptr == nullptr || ptr == this->inline_data())
+            return;
+        stats_free(container_kind::myvector, bytes(count));
+        if constexpr (use_realloc)
+            std::free(ptr);
+        else if constexpr (!default_allocator)
+            alloc_traits::deallocate(this->allocator(), ptr, count);
+        else if constexpr (alignment > alignof(T))
+            ::operator delete(ptr, bytes(count), std::align_val_t(alignment));
+        else
+            std::allocator<T>().deallocate(ptr, count);
+    }
+
+    // Лежат ли элементы во встроенном буфере
+    bool is_inline()
+    {
+        return Inline > 0 && buffer == this->inline_data();
+    }
+
+    // Уничтожает все элементы и освобождает память; вектор возвращается во встроенный буфер
+    void release()
+    {
+        std::destroy(buffer, buffer + length);
+        deallocate(buffer, reserved);
+        buffer = this->inline_data();
+        reserved = Inline;
         length = 0;
-        data = std::unique_ptr<T[]>(new T[capacity]);
     }
 
-    // Move-конструктор: перемещает массив и состояние из другого вектора
-    myvector(myvector &&vect)
+    // Забирает элементы другого вектора (свой вектор должен быть пуст после release()).
+    // Массив из кучи передаётся целиком, а из встроенного буфера элементы переносятся поштучно.
+    void steal(myvector &vect)
     {
-        data = std::move(vect.data);
-        capacity = vect.capacity;
+        if constexpr (Inline > 0)
+        {
+            if (vect.is_inline())
+            {
+                if constexpr (std::is_trivially_copyable<T>::value)
+                    std::memcpy(static_cast<void *>(buffer), vect.buffer, bytes(vect.length));
+                else
+                    std::uninitialized_move(vect.buffer, vect.buffer + vect.length, buffer);
+                length = vect.length;
+                vect.release();
+                return;
+            }
+        }
+
+        buffer = vect.buffer;
+        reserved = vect.reserved;
         length = vect.length;
 
-        // Обнуляем исходный вектор, чтобы он не удалил массив при деструкции
-        vect.data = nullptr;
-        vect.capacity = 0;
+        // Возвращаем исходный вектор во встроенный буфер, чтобы он не удалил массив при деструкции
+        vect.buffer = vect.inline_data();
+        vect.reserved = Inline;
         vect.length = 0;
     }
 
-    // Деструктор не нужен: unique_ptr сам удалит массив
-    ~myvector() = default;
+    // Переносит элементы в новый массив ёмкостью newCapacity (не больше Inline -
+    // во встроенный буфер). Если перемещение T не бросает исключений (или T нельзя
+    // скопировать) - элементы перемещаются, иначе копируются, чтобы при исключении
+    // старый массив остался целым.
+    void relocate(std::size_t newCapacity)
+    {
+        bool toInline = newCapacity <= Inline;
+        if (toInline && buffer == this->inline_data())
+            return; // элементы уже во встроенном буфере
+        stats_realloc(container_kind::myvector, bytes(length));
+
+        if constexpr (use_realloc)
+        {
+            if (!toInline && buffer != nullptr && buffer != this->inline_data())
+            {
+                // Массив из кучи в массив из кучи: realloc либо расширяет блок на
+                // месте, либо переносит его сам (для больших блоков - через mremap).
+                // При неудаче старый блок остаётся целым.
+                if (newCapacity > max_size())
+                    throw std::length_error("myvector is too long");
+                void *raw = std::realloc(buffer, bytes(newCapacity));
+                if (raw == nullptr)
+                    throw std::bad_alloc();
+                stats_free(container_kind::myvector, bytes(reserved));
+                stats_alloc(container_kind::myvector, bytes(newCapacity));
+                buffer = static_cast<T *>(raw);
+                reserved = newCapacity;
+                return;
+            }
+        }
+
+        T *newBuffer = toInline ? this->inline_data() : allocate(newCapacity);
+        if (toInline)
+            newCapacity = Inline;
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            // Тривиально копируемые элементы переносятся одним memcpy
+            if (length > 0)
+                std::memcpy(static_cast<void *>(newBuffer), buffer, bytes(length));
+            deallocate(buffer, reserved);
+            buffer = newBuffer;
+            reserved = newCapacity;
+            return;
+        }
+
+        try
+        {
+            if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value)
+                std::uninitialized_move(buffer, buffer + length, newBuffer);
+            else
+                std::uninitialized_copy(buffer, buffer + length, newBuffer);
+        }
+        catch (...)
+        {
+            deallocate(newBuffer, newCapacity);
+            throw;
+        }
+
+        std::destroy(buffer, buffer + length);
+        deallocate(buffer, reserved);
+        buffer = newBuffer;
+        reserved = newCapacity;
+    }
+
+    // Расширяет массив так, чтобы в него поместилось required элементов;
+    // новую ёмкость выбирает политика роста Growth
+    void grow(std::size_t required)
+    {
+        if (required > max_size())
+            throw std::length_error("myvector is too long");
+        relocate(std::min(Growth::next(reserved, required, sizeof(T)), max_size()));
+    }
+
+    // Можно ли скопировать диапазон одним memcpy: T тривиально копируемый,
+    // а итератор указывает в непрерывный массив таких же T
+    template <typename It>
+    static constexpr bool memcpy_source()
+    {
+        using source = std::remove_cv_t<typename std::iterator_traits<It>::value_type>;
+        if constexpr (!std::is_trivially_copyable<T>::value || !std::is_same<source, T>::value)
+            return false;
+        else
+            return std::is_pointer<It>::value || std::is_same<It, BasicIterator<false>>::value ||
+                   std::is_same<It, BasicIterator<true>>::value;
+    }
+
+    // Конструирует count элементов из [first, ...) в сырой памяти dest
+    template <typename It>
+    static void construct_from(T *dest, It first, std::size_t count)
+    {
+        if constexpr (memcpy_source<It>())
+        {
+            if (count > 0)
+                std::memcpy(static_cast<void *>(dest), &*first, bytes(count));
+        }
+        else
+        {
+            std::uninitialized_copy_n(first, count, dest);
+        }
+    }
+
+    // Итератор не слабее forward: длину диапазона можно узнать заранее
+    template <typename It>
+    static constexpr bool is_forward()
+    {
+        return std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value;
+    }
+
+public:
+    // Сколько элементов помещается во встроенный буфер
+    static constexpr std::size_t inline_capacity = Inline;
+
+    using allocator_type = Alloc;
+
+    // Конструктор по умолчанию: память не выделяется до первой вставки
+    myvector() = default;
+
+    // Пустой вектор, массив которого будет выделяться через allocator
+    explicit myvector(const Alloc &allocator) : allocator_base(array_allocator(allocator)) {}
+
+    // Move-конструктор: перемещает массив, состояние и аллокатор из другого вектора
+    myvector(myvector &&vect) : allocator_base(vect.allocator())
+    {
+        steal(vect);
+    }
+
+    // Вектор из списка инициализации: память выделяется один раз
+    myvector(std::initializer_list<T> init, const Alloc &allocator = Alloc()) : myvector(allocator)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    // Вектор из диапазона итераторов [first, last)
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    myvector(InputIt first, InputIt last, const Alloc &allocator = Alloc()) : myvector(allocator)
+    {
+        append_range(first, last);
+    }
+
+    // Аллокатор, которым вектор выделяет массив
+    Alloc get_allocator() const
+    {
+        return Alloc(this->allocator());
+    }
+
+    // Деструктор: уничтожает элементы и освобождает сырую память
+    ~myvector()
+    {
+        release();
+    }
 
     // Возвращает количество элементов
-    int size()
+    std::size_t size() const
     {
         return length;
     }
 
+    // Возвращает текущую ёмкость (сколько элементов влезет без перевыделения)
+    std::size_t capacity() const
+    {
+        return reserved;
+    }
+
+    // Пуст ли вектор
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Наибольшее возможное количество элементов
+    static constexpr std::size_t max_size()
+    {
+        return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(T);
+    }
+
+    // Гарантирует ёмкость не меньше count (элементы не меняются)
+    void reserve(std::size_t count)
+    {
+        if (count > max_size())
+            throw std::length_error("myvector is too long");
+        if (count > reserved)
+            relocate(count);
+    }
+
+    // Уменьшает ёмкость до количества элементов; пустой вектор освобождает память,
+    // а вектор не длиннее Inline возвращается во встроенный буфер
+    void shrink_to_fit()
+    {
+        if (reserved > length)
+            relocate(length);
+    }
+
+    // Меняет длину на count: лишние элементы уничтожаются, новые
+    // value-инициализируются (для int и POD - нулями)
+    void resize(std::size_t count)
+    {
+        if (count <= length)
+        {
+            std::destroy(buffer + count, buffer + length);
+            length = count;
+            return;
+        }
+        if (count > reserved)
+            grow(count);
+        std::uninitialized_value_construct(buffer + length, buffer + count);
+        length = count;
+    }
+
+    // Меняет длину на count, не инициализируя новые элементы (только для
+    // тривиально копируемых T): их нужно записать до чтения - например,
+    // прочитать в data() из файла. Экономит лишний проход по памяти, которым
+    // resize() заполнил бы их нулями
+    void resize_for_overwrite(std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "resize_for_overwrite needs a trivially copyable T");
+        if (count > reserved)
+            grow(count);
+        length = count;
+    }
+
+    // То же, но новые элементы - копии value
+    void resize(std::size_t count, const T &value)
+    {
+        if (count <= length)
+        {
+            std::destroy(buffer + count, buffer + length);
+            length = count;
+            return;
+        }
+        if (count > reserved)
+        {
+            // value может лежать в самом векторе - копируем до перевыделения
+            T copy(value);
+            grow(count);
+            std::uninitialized_fill(buffer + length, buffer + count, copy);
+        }
+        else
+        {
+            std::uninitialized_fill(buffer + length, buffer + count, value);
+        }
+        length = count;
+    }
+
+    // Заменяет содержимое элементами [first, last).
+    // Если длина известна заранее (forward-итераторы), память выделяется не больше одного раза.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last)
+    {
+        std::destroy(buffer, buffer + length);
+        length = 0;
+
+        if constexpr (is_forward<InputIt>())
+        {
+            std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+            if (count > reserved)
+            {
+                // Старые ячейки не нужны - выделяем сразу ровно под новые элементы
+                T *newBuffer = allocate(count);
+                deallocate(buffer, reserved);
+                buffer = newBuffer;
+                reserved = count;
+            }
+            construct_from(buffer, first, count);
+            length = count;
+        }
+        else
+        {
+            append_range(first, last);
+        }
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    // Добавление элементов [first, last) в конец
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last)
+    {
+        insert_range(length, first, last);
+    }
+
+    // Добавление в конец всех элементов диапазона (контейнера, initializer_list и т.п.)
+    template <typename Range>
+    void append_range(const Range &range)
+    {
+        using std::begin;
+        using std::end;
+        append_range(begin(range), end(range));
+    }
+
+    // Вставка элементов [first, last) перед позицией position.
+    // Для forward-итераторов память выделяется не больше одного раза, а для
+    // тривиально копируемых T хвост сдвигается и диапазон копируется memmove/memcpy.
+    // Диапазон не должен указывать в этот же вектор.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert_range(std::size_t position, InputIt first, InputIt last)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+
+        std::size_t oldLength = length;
+        if constexpr (is_forward<InputIt>())
+        {
+            std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+            if (count == 0)
+                return;
+            if (length + count > reserved)
+                grow(length + count);
+
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                // Раздвигаем хвост одним memmove и копируем диапазон в образовавшуюся дыру
+                T *gap = buffer + position;
+                std::size_t tailBytes = bytes(length - position);
+                stats_shift(container_kind::myvector, tailBytes);
+                std::memmove(static_cast<void *>(gap + count), gap, tailBytes);
+                try
+                {
+                    construct_from(gap, first, count);
+                }
+                catch (...)
+                {
+                    std::memmove(static_cast<void *>(gap), gap + count, tailBytes);
+                    throw;
+                }
+                length += count;
+                return;
+            }
+            else
+            {
+                // Конструируем новые элементы в конце и ставим их на место поворотом
+                construct_from(buffer + length, first, count);
+                length += count;
+            }
+        }
+        else
+        {
+            // Длина неизвестна - добавляем по одному; при исключении откатываем добавленное
+            try
+            {
+                for (; first != last; ++first)
+                    push_back(T(*first));
+            }
+            catch (...)
+            {
+                std::destroy(buffer + oldLength, buffer + length);
+                length = oldLength;
+                throw;
+            }
+        }
+
+        stats_shift(container_kind::myvector, bytes(length - position));
+        std::rotate(buffer + position, buffer + oldLength, buffer + length);
+    }
+
     // Добавление в конец: копирующая версия (для lvalue)
     void push_back(T &value)
     {
-        if (length == capacity)
+        if (length == reserved)
         {
-            resize(); // расширяем, если массив полон
+            T copy(value);    // value может ссылаться на элемент этого же вектора
+            grow(length + 1); // расширяем, если массив полон
+            new (buffer + length) T(std::move(copy));
+        }
+        else
+        {
+            new (buffer + length) T(value);
         }
-        data[length] = value;
         length++;
     }
 
     // Добавление в конец: перемещающая версия (для rvalue)
     void push_back(T &&value)
     {
-        if (length == capacity)
+        if (length == reserved)
+        {
+            T tmp(std::move(value));
+            grow(length + 1);
+            new (buffer + length) T(std::move(tmp));
+        }
+        else
         {
-            resize();
+            new (buffer + length) T(std::move(value));
         }
-        data[length] = std::move(value);
         length++;
     }
 
-    // Вставка в произвольную позицию: перемещающая версия
-    void insert(T &&value, int position)
+    // Добавление в конец: элемент конструируется прямо в ячейке буфера из args.
+    // Возвращает ссылку на добавленный элемент.
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
     {
-        if (position > length || position < 0)
-            throw std::out_of_range("Index out of range");
-
-        if (length == capacity)
+        if (length == reserved)
         {
-            resize();
+            T tmp(std::forward<Args>(args)...); // args могут ссылаться на элементы этого же вектора
+            grow(length + 1);
+            new (buffer + length) T(std::move(tmp));
         }
-
-        // Сдвигаем элементы вправо, начиная с конца
-        for (int i = length; i > position; --i)
+        else
         {
-            data[i] = data[i - 1];
+            new (buffer + length) T(std::forward<Args>(args)...);
         }
+        return buffer[length++];
+    }
 
-        data[position] = std::move(value);
-        length++;
+    // Вставка в произвольную позицию: элемент конструируется из args.
+    // В конце - прямо в ячейке буфера; в середине ячейка занята сдвигаемым
+    // элементом, поэтому значение сначала строится отдельно и перемещается на место.
+    template <typename... Args>
+    T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+
+        if (position == length)
+            return emplace_back(std::forward<Args>(args)...);
+
+        insert(T(std::forward<Args>(args)...), position);
+        return buffer[position];
     }
 
-    // Вставка в произвольную позицию: копирующая версия
-    void insert(T &value, int position)
+    // Вставка в произвольную позицию: перемещающая версия
+    void insert(T &&value, std::size_t position)
     {
-        if (position > length || position < 0)
+        if (position > length)
             throw std::out_of_range("Index out of range");
 
-        if (length == capacity)
+        if (length == reserved)
         {
-            resize();
+            T tmp(std::move(value));
+            grow(length + 1);
+            return insert(std::move(tmp), position);
         }
 
-        for (int i = length; i > position; --i)
+        if constexpr (std::is_trivially_copyable<T>::value)
         {
-            data[i] = data[i - 1];
+            // Копия на случай, если value - элемент этого же вектора, который сдвинется
+            T copy(value);
+            stats_shift(container_kind::myvector, bytes(length - position));
+            std::memmove(static_cast<void *>(buffer + position + 1), buffer + position, bytes(length - position));
+            new (buffer + position) T(copy);
+            length++;
+            return;
         }
 
-        data[position] = value;
+        if (position == length)
+        {
+            new (buffer + length) T(std::move(value));
+            length++;
+            return;
+        }
+
+        // Последний элемент переезжает в свободную ячейку, остальные сдвигаются вправо
+        stats_shift(container_kind::myvector, bytes(length - position));
+        new (buffer + length) T(std::move(buffer[length - 1]));
+        std::move_backward(buffer + position, buffer + length - 1, buffer + length);
+
+        buffer[position] = std::move(value);
         length++;
     }
 
+    // Вставка в произвольную позицию: копирующая версия
+    void insert(T &value, std::size_t position)
+    {
+        insert(T(value), position);
+    }
+
     // Удаление элемента по индексу
-    void erase(int position)
+    void erase(std::size_t position)
     {
-        if (position >= length || position < 0)
+        if (position >= length)
             throw std::out_of_range("Index out of range");
 
-        // Сдвигаем элементы влево, затирая удаляемый
-        for (int i = position; i < length - 1; ++i)
+        if constexpr (std::is_trivially_copyable<T>::value)
         {
-            data[i] = data[i + 1];
+            // Сдвигаем хвост влево одним memmove; деструкторы тривиальны
+            stats_shift(container_kind::myvector, bytes(length - position - 1));
+            std::memmove(static_cast<void *>(buffer + position), buffer + position + 1, bytes(length - position - 1));
+            length--;
+            return;
         }
 
+        // Сдвигаем элементы влево перемещением, затирая удаляемый
+        stats_shift(container_kind::myvector, bytes(length - position - 1));
+        std::move(buffer + position + 1, buffer + length, buffer + position);
+
+        // Последняя ячейка больше не занята - уничтожаем объект в ней
+        buffer[length - 1].~T();
         length--;
     }
 
-    // Доступ по индексу (с проверкой)
-    T &operator[](int index)
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK:
+    // в release - прямое обращение к массиву
+    T &operator[](std::size_t index)
     {
-        if (index < 0 || index >= length)
-            throw std::out_of_range("Index out of range");
-        return data[index];
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return buffer[index];
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return buffer[index];
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return buffer[index];
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return buffer[index];
+    }
+
+    // Первый и последний элементы. Пустой вектор проверяется только при LAB3_BOUNDS_CHECK
+    T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return buffer[0];
+    }
+
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return buffer[0];
+    }
+
+    T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return buffer[length - 1];
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return buffer[length - 1];
     }
 
     // Печать всех элементов (для отладки)
-    void print()
+    void print() const
     {
-        for (int i = 0; i < length; ++i)
-        {
-            std::cout << data[i] << ' ';
-        }
-        std::cout << '\n';
+        print_range(buffer, buffer + length);
+    }
+
+    // Вывод элементов через separator: текст копится в буфере и уходит в поток
+    // блоками по write_chunk_size байт, числа форматируются std::to_chars
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, buffer, buffer + length, separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, buffer, buffer + length, separator);
+    }
+
+    // Потоковый режим: готовые блоки текста передаются в sink(const char *data, std::size_t size)
+    // по мере заполнения буфера - весь вывод целиком в памяти не собирается
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, buffer, buffer + length, separator);
     }
 
     // Move-присваивание
@@ -163,13 +848,21 @@ public:
             return *this;
         }
 
-        data = std::move(vect.data);
-        capacity = vect.capacity;
-        length = vect.length;
-
-        vect.data = nullptr;
-        vect.capacity = 0;
-        vect.length = 0;
+        release();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+        {
+            this->allocator() = vect.allocator(); // аллокатор уходит вместе с массивом
+        }
+        else if (!(this->allocator() == vect.allocator()))
+        {
+            // Массив другого аллокатора забрать нельзя - перемещаем элементы в свой
+            reserve(vect.length);
+            std::uninitialized_move(vect.buffer, vect.buffer + vect.length, buffer);
+            length = vect.length;
+            vect.release();
+            return *this;
+        }
+        steal(vect);
         return *this;
     }
 
@@ -181,42 +874,240 @@ public:
             return *this;
         }
 
-        // Выделяем новый массив нужного размера
-        std::unique_ptr<T[]> newData(new T[vect.capacity]);
-        for (int i = 0; i < vect.length; ++i)
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
         {
-            newData[i] = vect.data[i]; // копируем элементы
+            // Старый массив возвращается старому аллокатору до смены
+            if (!(this->allocator() == vect.allocator()))
+                release();
+            this->allocator() = vect.allocator();
         }
 
-        data = std::move(newData);
-        capacity = vect.capacity;
+        if (vect.length <= Inline)
+        {
+            // Элементы источника помещаются во встроенный буфер
+            release();
+            construct_from(buffer, vect.buffer, vect.length);
+            length = vect.length;
+            return *this;
+        }
+
+        // Выделяем новый массив ровно под элементы источника и копируем их
+        T *newBuffer = allocate(vect.length);
+        try
+        {
+            construct_from(newBuffer, vect.buffer, vect.length); // memcpy для тривиально копируемых T
+        }
+        catch (...)
+        {
+            deallocate(newBuffer, vect.length);
+            throw;
+        }
+
+        release();
+        buffer = newBuffer;
+        reserved = vect.length;
         length = vect.length;
 
         return *this;
     }
 
-    // Итератор
-    class Iterator
+    // Итератор произвольного доступа (в C++20 - contiguous): обёртка над сырым
+    // указателем на элемент массива. IsConst = true - итератор только для чтения.
+    template <bool IsConst>
+    class BasicIterator
     {
-        T *ptr; // сырой указатель на текущий элемент массива
+        using element = std::conditional_t<IsConst, const T, T>;
+
+        element *ptr; // сырой указатель на текущий элемент массива
+
+        template <bool>
+        friend class BasicIterator;
 
     public:
-        Iterator(T *p) : ptr(p) {}
+        using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus >= 202002L
+        using iterator_concept = std::contiguous_iterator_tag;
+#endif
+        using value_type = std::remove_cv_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = element *;
+        using reference = element &;
+
+        BasicIterator() : ptr(nullptr) {}
+        BasicIterator(element *p) : ptr(p) {}
 
-        T &operator*() { return *ptr; }
-        T &get() { return *ptr; }
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst> &other) : ptr(other.ptr) {}
 
-        Iterator &operator++()
+        reference operator*() const { return *ptr; }
+        pointer operator->() const { return ptr; }
+        reference get() const { return *ptr; }
+        reference operator[](difference_type n) const { return ptr[n]; }
+
+        BasicIterator &operator++()
         {
             ++ptr;
             return *this;
         }
 
-        bool operator!=(const Iterator &other) const { return ptr != other.ptr; }
+        BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++ptr;
+            return old;
+        }
+
+        BasicIterator &operator--()
+        {
+            --ptr;
+            return *this;
+        }
+
+        BasicIterator operator--(int)
+        {
+            BasicIterator old = *this;
+            --ptr;
+            return old;
+        }
+
+        BasicIterator &operator+=(difference_type n)
+        {
+            ptr += n;
+            return *this;
+        }
+
+        BasicIterator &operator-=(difference_type n)
+        {
+            ptr -= n;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type n) { return it += n; }
+        friend BasicIterator operator+(difference_type n, BasicIterator it) { return it += n; }
+        friend BasicIterator operator-(BasicIterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const BasicIterator &a, const BasicIterator &b) { return a.ptr - b.ptr; }
+
+        friend bool operator==(const BasicIterator &a, const BasicIterator &b) { return a.ptr == b.ptr; }
+        friend bool operator!=(const BasicIterator &a, const BasicIterator &b) { return a.ptr != b.ptr; }
+        friend bool operator<(const BasicIterator &a, const BasicIterator &b) { return a.ptr < b.ptr; }
+        friend bool operator>(const BasicIterator &a, const BasicIterator &b) { return a.ptr > b.ptr; }
+        friend bool operator<=(const BasicIterator &a, const BasicIterator &b) { return a.ptr <= b.ptr; }
+        friend bool operator>=(const BasicIterator &a, const BasicIterator &b) { return a.ptr >= b.ptr; }
     };
 
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // Типы в стиле стандартной библиотеки - для std::back_inserter, std::iterator_traits и т.п.
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
     // Начало диапазона: первый элемент
-    Iterator begin() { return Iterator(data.get()); }
+    Iterator begin() { return Iterator(buffer); }
     // Конец диапазона: один за последним элементом
-    Iterator end() { return Iterator(data.get() + length); }
-};
\ No newline at end of file
+    Iterator end() { return Iterator(buffer + length); }
+
+    ConstIterator begin() const { return ConstIterator(buffer); }
+    ConstIterator end() const { return ConstIterator(buffer + length); }
+    ConstIterator cbegin() const { return ConstIterator(buffer); }
+    ConstIterator cend() const { return ConstIterator(buffer + length); }
+
+    // Обратный обход: от последнего элемента к первому
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+    // Сырой указатель на непрерывный массив элементов: по нему стандартная
+    // библиотека выбирает memmove/векторизованные реализации алгоритмов
+    T *data() { return buffer; }
+    const T *data() const { return buffer; }
+
+    // Поиск и свёртки. Для int32_t и float работают векторные ядра из simd.h
+    // (AVX2/AVX-512/NEON, выбираются при первом вызове), для остальных T -
+    // стандартные алгоритмы. Границы не проверяются: обход идёт по data().
+
+    // "Не найдено" для index_of
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    // Индекс первого элемента, равного value, или npos
+    std::size_t index_of(const T &value) const
+    {
+        std::size_t index = simd_find(buffer, length, value);
+        return index == length ? npos : index;
+    }
+
+    // Итератор на первый элемент, равный value, или end()
+    Iterator find(const T &value)
+    {
+        return Iterator(buffer + simd_find(buffer, length, value));
+    }
+
+    ConstIterator find(const T &value) const
+    {
+        return ConstIterator(buffer + simd_find(buffer, length, value));
+    }
+
+    // Есть ли элемент, равный value
+    bool contains(const T &value) const
+    {
+        return simd_find(buffer, length, value) != length;
+    }
+
+    // Количество элементов, равных value
+    std::size_t count(const T &value) const
+    {
+        return simd_count(buffer, length, value);
+    }
+
+    // Наименьший и наибольший элементы (для float с NaN результат не определён)
+    std::pair<T, T> min_max() const
+    {
+        check_not_empty(length == 0, "Vector is empty");
+        return simd_min_max(buffer, length);
+    }
+
+    // Сумма элементов: целые складываются в 64-битном накопителе (int64_t/uint64_t),
+    // вещественные - в T по дорожкам вектора
+    simd_sum_t<T> sum() const
+    {
+        static_assert(std::is_arithmetic<T>::value, "sum() needs an arithmetic element type");
+        return simd_sum_of(buffer, length);
+    }
+};
+
+// Вектор с оптимизацией малого буфера: до N элементов хранятся внутри объекта
+// без обращений к куче, массив в куче заводится, только когда элементов
+// становится больше N. Перемещение вектора во встроенном буфере переносит
+// элементы поштучно (O(N)), а не передаёт указатель.
+template <typename T, std::size_t N, typename Growth = growth_2x, typename Alloc = std::allocator<T>>
+using small_myvector = myvector<T, N, Growth, Alloc>;
+
+// Вектор с массивом, выровненным по Align байт: векторные ядра поиска и свёрток
+// читают его выровненными загрузками с первого элемента, без скалярного начала
+template <typename T, std::size_t Align = 64, typename Growth = growth_2x>
+using aligned_myvector = myvector<T, 0, aligned_to<Align, Growth>>;
+
+// Векторы с массивом из std::pmr::memory_resource, как std::pmr::vector:
+//     std::pmr::monotonic_buffer_resource arena;
+//     pmr::myvector<int> v{&arena};
+// Память арены освобождается вся сразу вместе с ней, поштучные deallocate - пустые
+namespace pmr
+{
+    template <typename T, std::size_t Inline = 0, typename Growth = growth_2x>
+    using myvector = ::myvector<T, Inline, Growth, std::pmr::polymorphic_allocator<T>>;
+
+    template <typename T, std::size_t N, typename Growth = growth_2x>
+    using small_myvector = ::myvector<T, N, Growth, std::pmr::polymorphic_allocator<T>>;
+}
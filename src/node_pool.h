@@ -0,0 +1,200 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+// Пул памяти для узлов списков.
+// Память берётся у системы крупными блоками и нарезается на ячейки; освобождённая
+// ячейка попадает в список свободных своего размера и отдаётся следующему узлу
+// того же размера. Соседние узлы оказываются рядом в памяти, а вставка/удаление
+// не обращаются к malloc/free. Все блоки возвращаются системе разом - в release()
+// или в деструкторе пула.
+//
+// Пул не потокобезопасен: один пул - один поток (или внешняя синхронизация).
+class node_pool
+{
+private:
+    // Ячейки выделяются кратно этому размеру - так любая ячейка выровнена как max_align_t
+    static constexpr std::size_t granularity = alignof(std::max_align_t);
+    // Количество классов размеров: ячейки до granularity * sizeClasses байт берутся из пула
+    static constexpr std::size_t sizeClasses = 32;
+
+    // Свободная ячейка: пока она не занята, в ней хранится ссылка на следующую свободную
+    struct FreeSlot
+    {
+        FreeSlot *next;
+    };
+
+    // Заголовок блока: блоки связаны в список, чтобы release() мог их освободить
+    struct alignas(std::max_align_t) Block
+    {
+        Block *next;
+    };
+
+    FreeSlot *freeLists[sizeClasses] = {}; // свободные ячейки по классам размеров
+    Block *blocks = nullptr;               // все выделенные блоки
+    char *cursor = nullptr;                // начало ещё не нарезанной части текущего блока
+    char *limit = nullptr;                 // конец текущего блока
+    std::size_t blockSize;                 // размер полезной части следующего блока
+
+    // Номер класса размера для запроса в bytes байт
+    static std::size_t size_class(std::size_t bytes)
+    {
+        return bytes == 0 ? 0 : (bytes - 1) / granularity;
+    }
+
+    // Подходит ли запрос для пула (слишком большие и сверхвыровненные идут напрямую в operator new)
+    static bool pooled(std::size_t bytes, std::size_t alignment)
+    {
+        return alignment <= granularity && size_class(bytes) < sizeClasses;
+    }
+
+    // Заводит новый блок, в котором поместится хотя бы одна ячейка slotBytes
+    void grow(std::size_t slotBytes)
+    {
+        std::size_t payload = blockSize < slotBytes ? slotBytes : blockSize;
+        Block *block = static_cast<Block *>(::operator new(sizeof(Block) + payload));
+        block->next = blocks;
+        blocks = block;
+        cursor = reinterpret_cast<char *>(block + 1);
+        limit = cursor + payload;
+    }
+
+public:
+    // blockBytes - сколько памяти запрашивать у системы за один раз
+    explicit node_pool(std::size_t blockBytes = 64 * 1024) : blockSize(blockBytes) {}
+
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+
+    // Деструктор: освобождает все блоки одним проходом по списку блоков
+    ~node_pool()
+    {
+        release();
+    }
+
+    // Выделяет bytes байт с выравниванием alignment
+    void *allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
+    {
+        if (!pooled(bytes, alignment))
+            return ::operator new(bytes, std::align_val_t(alignment));
+
+        std::size_t cls = size_class(bytes);
+        if (freeLists[cls] != nullptr)
+        {
+            // Переиспользуем ячейку, освобождённую ранее
+            FreeSlot *slot = freeLists[cls];
+            freeLists[cls] = slot->next;
+            return slot;
+        }
+
+        std::size_t slotBytes = (cls + 1) * granularity;
+        if (static_cast<std::size_t>(limit - cursor) < slotBytes)
+            grow(slotBytes);
+
+        void *result = cursor;
+        cursor += slotBytes;
+        return result;
+    }
+
+    // Возвращает ячейку в пул (bytes и alignment - те же, что и при выделении)
+    void deallocate(void *ptr, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        if (ptr == nullptr)
+            return;
+        if (!pooled(bytes, alignment))
+        {
+            ::operator delete(ptr, std::align_val_t(alignment));
+            return;
+        }
+
+        std::size_t cls = size_class(bytes);
+        FreeSlot *slot = static_cast<FreeSlot *>(ptr);
+        slot->next = freeLists[cls];
+        freeLists[cls] = slot;
+    }
+
+    // Освобождает сразу всю память пула.
+    // Все выделенные из него указатели становятся недействительными, поэтому
+    // вызывать можно только когда контейнеры, использующие пул, уже уничтожены
+    // (или их элементы не требуют деструкторов и больше не используются).
+    void release() noexcept
+    {
+        while (blocks != nullptr)
+        {
+            Block *next = blocks->next;
+            ::operator delete(blocks);
+            blocks = next;
+        }
+        for (FreeSlot *&head : freeLists)
+            head = nullptr;
+        cursor = nullptr;
+        limit = nullptr;
+    }
+};
+
+// Аллокатор в модели стандартной библиотеки поверх node_pool.
+// Подставляется в slist/dlist вторым параметром шаблона:
+//     node_pool pool;
+//     slist<int, pool_allocator<int>> list{pool_allocator<int>(pool)};
+// Аллокатор по умолчанию (без пула) работает через обычный operator new.
+template <typename T>
+class pool_allocator
+{
+private:
+    node_pool *pool = nullptr; // пул, из которого берётся память (не владеет)
+
+    template <typename U>
+    friend class pool_allocator;
+
+public:
+    using value_type = T;
+    // Пул привязан к контейнеру: при move-присваивании и swap он уходит вместе
+    // с узлами, а копия контейнера продолжает пользоваться своим пулом
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    pool_allocator() noexcept = default;
+    explicit pool_allocator(node_pool &source) noexcept : pool(&source) {}
+
+    // Конвертирующий конструктор: нужен для rebind (аллокатор T -> аллокатор узла)
+    template <typename U>
+    pool_allocator(const pool_allocator<U> &other) noexcept : pool(other.pool) {}
+
+    T *allocate(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+        if (pool == nullptr)
+            return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+        return static_cast<T *>(pool->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *ptr, std::size_t count) noexcept
+    {
+        if (pool == nullptr)
+            ::operator delete(ptr, std::align_val_t(alignof(T)));
+        else
+            pool->deallocate(ptr, count * sizeof(T), alignof(T));
+    }
+
+    // Пул, с которым работает аллокатор (nullptr - глобальная куча)
+    node_pool *resource() const noexcept
+    {
+        return pool;
+    }
+
+    template <typename U>
+    bool operator==(const pool_allocator<U> &other) const noexcept
+    {
+        return pool == other.pool;
+    }
+
+    template <typename U>
+    bool operator!=(const pool_allocator<U> &other) const noexcept
+    {
+        return pool != other.pool;
+    }
+};
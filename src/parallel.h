@@ -0,0 +1,180 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "myvector.h"
+
+// Параллельные массовые операции над myvector: массив делится на непрерывные
+// куски, каждый кусок обрабатывает свой поток (первый - вызывающий). Вектор
+// короче grain элементов на поток обрабатывается последовательно - для малых
+// массивов запуск потоков дороже самой работы.
+//
+// Функции f, op и comp вызываются из разных потоков одновременно и не должны
+// изменять общее состояние без синхронизации. Исключение из любого куска
+// пробрасывается вызывающему после завершения всех потоков (первое по порядку).
+
+// Минимум элементов на поток по умолчанию
+constexpr std::size_t parallel_grain = std::size_t(1) << 15;
+
+// Сколько кусков заводить для count элементов: не больше числа ядер
+// и не меньше grain элементов на кусок
+inline std::size_t parallel_chunks(std::size_t count, std::size_t grain)
+{
+    std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t byGrain = count / std::max<std::size_t>(grain, 1);
+    return std::max<std::size_t>(1, std::min(threads, byGrain));
+}
+
+// Выполняет body(i, first, last) для кусков [first, last), на которые делится
+// [0, count): chunks - 1 новых потоков и вызывающий поток
+template <typename Body>
+void parallel_run(std::size_t count, std::size_t chunks, Body &&body)
+{
+    if (chunks <= 1)
+    {
+        body(std::size_t(0), std::size_t(0), count);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(chunks);
+    auto run = [&](std::size_t i)
+    {
+        try
+        {
+            body(i, count * i / chunks, count * (i + 1) / chunks);
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(chunks - 1);
+    try
+    {
+        for (std::size_t i = 1; i < chunks; ++i)
+            threads.emplace_back(run, i);
+    }
+    catch (...)
+    {
+        // Поток не создался: оставшиеся куски выполняем сами
+        for (std::size_t i = threads.size() + 1; i < chunks; ++i)
+            run(i);
+    }
+    run(0);
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (std::exception_ptr &error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+// Вызывает f(element) для каждого элемента
+template <typename T, std::size_t Inline, typename Growth, typename Alloc, typename F>
+void parallel_for_each(myvector<T, Inline, Growth, Alloc> &vect, F f, std::size_t grain = parallel_grain)
+{
+    T *items = vect.data();
+    parallel_run(vect.size(), parallel_chunks(vect.size(), grain),
+                 [items, &f](std::size_t, std::size_t first, std::size_t last)
+                 {
+                     for (std::size_t i = first; i < last; ++i)
+                         f(items[i]);
+                 });
+}
+
+// Заменяет каждый элемент на f(element) (преобразование на месте)
+template <typename T, std::size_t Inline, typename Growth, typename Alloc, typename F>
+void parallel_transform(myvector<T, Inline, Growth, Alloc> &vect, F f, std::size_t grain = parallel_grain)
+{
+    T *items = vect.data();
+    parallel_run(vect.size(), parallel_chunks(vect.size(), grain),
+                 [items, &f](std::size_t, std::size_t first, std::size_t last)
+                 {
+                     for (std::size_t i = first; i < last; ++i)
+                         items[i] = f(items[i]);
+                 });
+}
+
+// Свёртка init op e0 op e1 op ...: каждый кусок сворачивается отдельно, затем
+// частичные результаты - по порядку кусков. op должна быть ассоциативной
+// (для double сумма может отличаться от последовательной в последних знаках)
+template <typename T, std::size_t Inline, typename Growth, typename Alloc, typename R, typename Op = std::plus<>>
+R parallel_reduce(const myvector<T, Inline, Growth, Alloc> &vect, R init, Op op = Op(),
+                  std::size_t grain = parallel_grain)
+{
+    const T *items = vect.data();
+    const std::size_t chunks = parallel_chunks(vect.size(), grain);
+    if (chunks <= 1)
+    {
+        for (std::size_t i = 0; i < vect.size(); ++i)
+            init = op(std::move(init), items[i]);
+        return init;
+    }
+
+    // Кусок сворачивается начиная со своего первого элемента - нейтральный
+    // элемент операции не нужен (куски при chunks > 1 не пусты)
+    std::vector<R> partial(chunks, init);
+    parallel_run(vect.size(), chunks,
+                 [items, &op, &partial](std::size_t chunk, std::size_t first, std::size_t last)
+                 {
+                     R acc = R(items[first]);
+                     for (std::size_t i = first + 1; i < last; ++i)
+                         acc = op(std::move(acc), items[i]);
+                     partial[chunk] = std::move(acc);
+                 });
+
+    for (R &value : partial)
+        init = op(std::move(init), std::move(value));
+    return init;
+}
+
+// Сортировка: куски сортируются параллельно, затем соседние отсортированные
+// куски попарно сливаются (std::inplace_merge), каждый раунд слияний - тоже
+// параллельно. Сортировка неустойчивая, как std::sort
+template <typename T, std::size_t Inline, typename Growth, typename Alloc, typename Compare = std::less<>>
+void parallel_sort(myvector<T, Inline, Growth, Alloc> &vect, Compare comp = Compare(),
+                   std::size_t grain = parallel_grain)
+{
+    T *items = vect.data();
+    const std::size_t count = vect.size();
+    const std::size_t chunks = parallel_chunks(count, grain);
+
+    parallel_run(count, chunks,
+                 [items, &comp](std::size_t, std::size_t first, std::size_t last)
+                 {
+                     std::sort(items + first, items + last, comp);
+                 });
+
+    // Границы отсортированных отрезков: отрезок k - [bounds[k], bounds[k + 1])
+    std::vector<std::size_t> bounds(chunks + 1);
+    for (std::size_t i = 0; i <= chunks; ++i)
+        bounds[i] = count * i / chunks;
+
+    while (bounds.size() > 2)
+    {
+        const std::size_t pairs = (bounds.size() - 1) / 2;
+        parallel_run(pairs, pairs,
+                     [items, &comp, &bounds](std::size_t pair, std::size_t, std::size_t)
+                     {
+                         std::inplace_merge(items + bounds[2 * pair], items + bounds[2 * pair + 1],
+                                            items + bounds[2 * pair + 2], comp);
+                     });
+
+        // Слитые пары становятся отрезками следующего раунда; нечётный последний
+        // отрезок переходит в него без изменений
+        std::vector<std::size_t> merged;
+        for (std::size_t i = 0; i < bounds.size(); i += 2)
+            merged.push_back(bounds[i]);
+        if (merged.back() != bounds.back())
+            merged.push_back(bounds.back());
+        bounds = std::move(merged);
+    }
+}
@@ -0,0 +1,703 @@
+#pragma once
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <initializer_list>
+#include "bounds_check.h"
+#include "write_buffer.h"
+#include "stats.h"
+
+// Узел двусвязного списка на сырых указателях.
+// Узел ничем не владеет: все узлы принадлежат списку, который их создаёт и удаляет.
+// Нет блока управления и счётчиков ссылок - только значение и две ссылки.
+template <typename T>
+struct RawDoubleNode
+{
+    T value;
+    RawDoubleNode<T> *next; // следующий узел (или nullptr)
+    RawDoubleNode<T> *prev; // предыдущий узел (или nullptr)
+
+    // Конструктор для lvalue
+    RawDoubleNode(const T &val) : value(val), next(nullptr), prev(nullptr) {}
+
+    // Конструктор для rvalue
+    RawDoubleNode(T &&val) : value(std::move(val)), next(nullptr), prev(nullptr) {}
+
+    // Конструирование значения на месте из аргументов его конструктора (для emplace)
+    template <typename... Args>
+    explicit RawDoubleNode(std::in_place_t, Args &&...args)
+        : value(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
+};
+
+// Двусвязный список с тем же интерфейсом, что и dlist, но на сырых указателях.
+// Единственный владелец узлов - сам список: обход - это просто переход по
+// указателю, без атомарных инкрементов/декрементов shared_ptr, а узел не несёт
+// блок управления и weak_ptr.
+template <typename T, typename Alloc = std::allocator<T>>
+class rawdlist
+{
+private:
+    using node_type = RawDoubleNode<T>;
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc; // аллокатор узлов
+    node_type *head;      // первый элемент списка (nullptr если пуст)
+    node_type *tail;      // последний элемент (nullptr если пуст)
+    std::size_t length;   // текущее количество элементов
+
+    // Создаёт узел через аллокатор списка; значение строится прямо в узле из args
+    template <typename... Args>
+    node_type *make_node(Args &&...args)
+    {
+        node_type *raw = node_traits::allocate(alloc, 1);
+        try
+        {
+            node_traits::construct(alloc, raw, std::in_place, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(alloc, raw, 1);
+            throw;
+        }
+        stats_alloc(container_kind::rawdlist, sizeof(node_type));
+        return raw;
+    }
+
+    // Уничтожает узел и возвращает память аллокатору
+    void destroy_node(node_type *node)
+    {
+        node_traits::destroy(alloc, node);
+        node_traits::deallocate(alloc, node, 1);
+        stats_free(container_kind::rawdlist, sizeof(node_type));
+    }
+
+    // Забирает цепочку узлов другого списка (свой список должен быть пуст)
+    void steal(rawdlist &list)
+    {
+        head = list.head;
+        tail = list.tail;
+        length = list.length;
+
+        list.head = nullptr;
+        list.tail = nullptr;
+        list.length = 0;
+    }
+
+    // Присоединяет готовый узел в конец за O(1)
+    void link_back(node_type *newNode)
+    {
+        if (head == nullptr)
+        {
+            head = newNode;
+        }
+        else
+        {
+            newNode->prev = tail;
+            tail->next = newNode;
+        }
+        tail = newNode;
+        length++;
+    }
+
+    // Узел с номером index (0 <= index < length): обход с ближнего к index конца,
+    // от head по next или от tail по prev
+    node_type *node_at(std::size_t index) const
+    {
+        stats_walk(container_kind::rawdlist, index < length / 2 ? index : length - 1 - index);
+        if (index < length / 2)
+        {
+            node_type *cur = head;
+            for (std::size_t cnt = 0; cnt < index; ++cnt)
+                cur = cur->next;
+            return cur;
+        }
+
+        node_type *cur = tail;
+        for (std::size_t cnt = length - 1; cnt > index; --cnt)
+            cur = cur->prev;
+        return cur;
+    }
+
+    // Вставляет готовый узел в позицию position
+    void link_at(node_type *newNode, std::size_t position)
+    {
+        if (position == length)
+        {
+            link_back(newNode);
+            return;
+        }
+
+        // Вставляем перед узлом, стоящим сейчас на позиции position
+        link_before(ConstIterator(node_at(position), this), newNode);
+    }
+
+public:
+    // Конструктор пустого списка
+    rawdlist() : rawdlist(Alloc()) {}
+
+    // Пустой список, узлы которого будут выделяться через allocator
+    explicit rawdlist(const Alloc &allocator) : alloc(allocator)
+    {
+        head = nullptr;
+        tail = nullptr;
+        length = 0;
+    }
+
+    // Список из списка инициализации
+    rawdlist(std::initializer_list<T> init, const Alloc &allocator = Alloc()) : rawdlist(allocator)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    // Список из диапазона итераторов [first, last): узлы цепляются за один проход
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    rawdlist(InputIt first, InputIt last, const Alloc &allocator = Alloc()) : rawdlist(allocator)
+    {
+        append_range(first, last);
+    }
+
+    // Move-конструктор: "перехватывает" узлы (и аллокатор) из другого списка
+    rawdlist(rawdlist &&list) : alloc(std::move(list.alloc))
+    {
+        steal(list);
+    }
+
+    // Деструктор: список - единственный владелец, поэтому удаляет узлы сам
+    ~rawdlist()
+    {
+        clear();
+    }
+
+    // Аллокатор, которым список выделяет узлы
+    Alloc get_allocator() const
+    {
+        return Alloc(alloc);
+    }
+
+    // Удаляет все элементы
+    void clear()
+    {
+        node_type *cur = head;
+        while (cur != nullptr)
+        {
+            node_type *next = cur->next;
+            destroy_node(cur);
+            cur = next;
+        }
+        head = nullptr;
+        tail = nullptr;
+        length = 0;
+    }
+
+    // Вставка в конец: версия для lvalue (копирование)
+    void push_back(T &value)
+    {
+        link_back(make_node(value));
+    }
+
+    // Вставка в конец: версия для rvalue (перемещение)
+    void push_back(T &&value)
+    {
+        link_back(make_node(std::move(value)));
+    }
+
+    // Вставка в конец: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        link_back(make_node(std::forward<Args>(args)...));
+        return tail->value;
+    }
+
+    // Вставка в начало: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return emplace(0, std::forward<Args>(args)...);
+    }
+
+    // Вставка в начало: версия для lvalue (копирование)
+    void push_front(T &value)
+    {
+        insert(value, 0);
+    }
+
+    // Вставка в начало: версия для rvalue (перемещение)
+    void push_front(T &&value)
+    {
+        insert(std::move(value), 0);
+    }
+
+    // Удаление первого элемента
+    void pop_front()
+    {
+        if (head == nullptr)
+            throw std::out_of_range("List is empty");
+        erase(0);
+    }
+
+    // Первый элемент за O(1). Пустой список проверяется только при LAB3_BOUNDS_CHECK
+    T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->value;
+    }
+
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->value;
+    }
+
+    // Последний элемент за O(1)
+    T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
+    }
+
+    // Простой вывод списка
+    void print() const
+    {
+        print_range(begin(), end());
+    }
+
+    // Вывод элементов через separator: текст копится в буфере и уходит в поток
+    // блоками по write_chunk_size байт, числа форматируются std::to_chars
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Потоковый режим: готовые блоки текста передаются в sink(const char *data, std::size_t size)
+    // по мере заполнения буфера - весь вывод целиком в памяти не собирается
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Возвращает текущую длину
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    // Пуст ли список
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Вставка в произвольную позицию: элемент конструируется прямо в узле из args.
+    // Возвращает ссылку на вставленный элемент.
+    template <typename... Args>
+    T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+        node_type *newNode = make_node(std::forward<Args>(args)...);
+        link_at(newNode, position);
+        return newNode->value;
+    }
+
+    // Вставка в произвольную позицию: перемещение
+    void insert(T &&value, std::size_t position)
+    {
+        emplace(position, std::move(value));
+    }
+
+    // Вставка в произвольную позицию: копирование
+    void insert(T &value, std::size_t position)
+    {
+        emplace(position, value);
+    }
+
+    // Удаление по индексу
+    void erase(std::size_t position)
+    {
+        if (position >= length)
+            throw std::out_of_range("Index out of range");
+        erase(ConstIterator(node_at(position), this));
+    }
+
+    // Move-присваивание
+    rawdlist &operator=(rawdlist &&list)
+    {
+        if (this == &list)
+            return *this;
+
+        clear();
+
+        if constexpr (node_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc = list.alloc; // аллокатор уходит вместе с узлами
+        }
+        else if (!(alloc == list.alloc))
+        {
+            // Узлы другого аллокатора освобождать нельзя - перемещаем значения в свои узлы
+            for (node_type *cur = list.head; cur != nullptr; cur = cur->next)
+            {
+                link_back(make_node(std::move(cur->value)));
+            }
+            list.clear();
+            return *this;
+        }
+
+        steal(list);
+        return *this;
+    }
+
+    // Copy-присваивание: создаёт копию поэлементно
+    rawdlist &operator=(rawdlist &list)
+    {
+        if (this == &list)
+            return *this;
+
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value)
+        {
+            alloc = list.alloc;
+        }
+
+        for (node_type *cur = list.head; cur != nullptr; cur = cur->next)
+        {
+            link_back(make_node(cur->value));
+        }
+        return *this;
+    }
+
+    // Двунаправленный итератор (поддерживает range-based for, обратный обход и
+    // алгоритмы STL). Кроме узла хранит список-владелец: end() - это nullptr,
+    // и шаг назад от него должен попасть в tail. IsConst = true - только для чтения.
+    template <bool IsConst>
+    class BasicIterator
+    {
+        using node = std::conditional_t<IsConst, const node_type, node_type>;
+
+        node *ptr;             // сырой указатель на текущий узел (nullptr - конец)
+        const rawdlist *owner; // список, по которому идём
+
+        template <bool>
+        friend class BasicIterator;
+        friend class rawdlist;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T, T> *;
+        using reference = std::conditional_t<IsConst, const T, T> &;
+
+        BasicIterator() : ptr(nullptr), owner(nullptr) {}
+        BasicIterator(node *p, const rawdlist *list) : ptr(p), owner(list) {}
+
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst> &other) : ptr(other.ptr), owner(other.owner) {}
+
+        reference operator*() const { return ptr->value; } // разыменование: получаем значение
+        pointer operator->() const { return &ptr->value; }
+        reference get() const { return ptr->value; }       // альтернативный способ
+
+        // Префиксный инкремент: переходим к следующему узлу
+        BasicIterator &operator++()
+        {
+            if (ptr != nullptr)
+                ptr = ptr->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        // Префиксный декремент: переходим к предыдущему узлу (от end() - к последнему)
+        BasicIterator &operator--()
+        {
+            if (ptr == nullptr)
+                ptr = owner->tail;
+            else
+                ptr = ptr->prev;
+            return *this;
+        }
+
+        BasicIterator operator--(int)
+        {
+            BasicIterator old = *this;
+            --*this;
+            return old;
+        }
+
+        // Сравнение: нужно для условия цикла for (it != end())
+        friend bool operator==(const BasicIterator &a, const BasicIterator &b) { return a.ptr == b.ptr; }
+        friend bool operator!=(const BasicIterator &a, const BasicIterator &b) { return a.ptr != b.ptr; }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // Типы в стиле стандартной библиотеки
+    using value_type = T;
+    using allocator_type = Alloc;
+    using reference = T &;
+    using const_reference = const T &;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    // Начало итерации
+    Iterator begin() { return Iterator(head, this); }
+    // Конец итерации (nullptr)
+    Iterator end() { return Iterator(nullptr, this); }
+
+    ConstIterator begin() const { return ConstIterator(head, this); }
+    ConstIterator end() const { return ConstIterator(nullptr, this); }
+    ConstIterator cbegin() const { return ConstIterator(head, this); }
+    ConstIterator cend() const { return ConstIterator(nullptr, this); }
+
+    // Заменяет содержимое элементами [first, last).
+    // Новая цепочка строится целиком до того, как старая будет удалена.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last)
+    {
+        rawdlist chain(first, last, get_allocator());
+        clear();
+        steal(chain);
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    // Добавление элементов [first, last) в конец
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            link_back(make_node(*first));
+        }
+    }
+
+    // Добавление в конец всех элементов диапазона (контейнера, initializer_list и т.п.)
+    template <typename Range>
+    void append_range(const Range &range)
+    {
+        using std::begin;
+        using std::end;
+        append_range(begin(range), end(range));
+    }
+
+    // Вставка элементов [first, last) перед позицией position.
+    // Узлы сначала собираются в отдельную цепочку, затем она вшивается в список
+    // целиком (splice): до позиции - один проход, каждая вставка - O(1).
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert_range(std::size_t position, InputIt first, InputIt last)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+
+        rawdlist chain(first, last, get_allocator());
+        ConstIterator pos = position < length ? ConstIterator(node_at(position), this) : cend();
+        splice(pos, chain);
+    }
+
+    // Обратный обход: от tail к head по ссылкам prev
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+    // Вставка перед позицией pos за O(1): перемещение.
+    // Возвращает итератор на вставленный элемент.
+    Iterator insert(ConstIterator pos, T &&value)
+    {
+        return link_before(pos, make_node(std::move(value)));
+    }
+
+    // Вставка перед позицией pos за O(1): копирование
+    Iterator insert(ConstIterator pos, T &value)
+    {
+        return link_before(pos, make_node(value));
+    }
+
+    // Вставка перед позицией pos за O(1): элемент конструируется прямо в узле из args
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args &&...args)
+    {
+        return link_before(pos, make_node(std::forward<Args>(args)...));
+    }
+
+    // Удаление элемента в позиции pos за O(1).
+    // Возвращает итератор на элемент после удалённого.
+    Iterator erase(ConstIterator pos)
+    {
+        if (pos.ptr == nullptr)
+            throw std::out_of_range("Iterator out of range");
+
+        node_type *victim = const_cast<node_type *>(pos.ptr);
+        node_type *next = victim->next;
+        unlink(victim, victim);
+        destroy_node(victim);
+        length--;
+        return Iterator(next, this);
+    }
+
+    // Переносит узлы [first, last) из other (может быть этим же списком) перед pos.
+    // Узлы не копируются и не выделяются заново - перешиваются только ссылки на
+    // концах диапазона. Аллокаторы списков должны быть равны: узлы потом
+    // освобождает уже этот список. Пересчёт size() стоит O(длины диапазона), если
+    // переносится часть другого списка; весь список или диапазон внутри своего - O(1).
+    void splice(ConstIterator pos, rawdlist &other, ConstIterator first, ConstIterator last)
+    {
+        if (first == last)
+            return;
+
+        std::size_t count = 0;
+        if (&other != this)
+        {
+            if (first == other.cbegin() && last == other.cend())
+                count = other.length;
+            else
+                count = static_cast<std::size_t>(std::distance(first, last));
+        }
+
+        node_type *chainHead = const_cast<node_type *>(first.ptr);
+        node_type *chainTail = last.ptr == nullptr ? other.tail : last.ptr->prev;
+        other.unlink(chainHead, chainTail);
+        other.length -= count;
+
+        link_chain_before(pos, chainHead, chainTail);
+        length += count;
+    }
+
+    // Переносит весь other перед pos за O(1)
+    void splice(ConstIterator pos, rawdlist &other)
+    {
+        splice(pos, other, other.cbegin(), other.cend());
+    }
+
+    // Переносит один элемент it из other перед pos за O(1)
+    void splice(ConstIterator pos, rawdlist &other, ConstIterator it)
+    {
+        ConstIterator next = it;
+        ++next;
+        // Внутри своего списка элемент может уже стоять на месте. Для чужого
+        // списка сравнивать нельзя: end() здесь и итератор за последним в other
+        // оба пустые
+        if (&other == this && (pos == it || pos == next))
+            return;
+        splice(pos, other, it, next);
+    }
+
+private:
+    // Цепляет готовый узел перед pos
+    Iterator link_before(ConstIterator pos, node_type *newNode)
+    {
+        link_chain_before(pos, newNode, newNode);
+        length++;
+        return Iterator(newNode, this);
+    }
+
+    // Вырезает цепочку chainHead..chainTail из списка (length не меняет)
+    void unlink(node_type *chainHead, node_type *chainTail)
+    {
+        if (chainHead->prev != nullptr)
+            chainHead->prev->next = chainTail->next;
+        else
+            head = chainTail->next;
+
+        if (chainTail->next != nullptr)
+            chainTail->next->prev = chainHead->prev;
+        else
+            tail = chainHead->prev;
+
+        chainHead->prev = nullptr;
+        chainTail->next = nullptr;
+    }
+
+    // Вставляет цепочку chainHead..chainTail перед pos (length не меняет)
+    void link_chain_before(ConstIterator pos, node_type *chainHead, node_type *chainTail)
+    {
+        node_type *next = const_cast<node_type *>(pos.ptr);
+        node_type *before = next != nullptr ? next->prev : tail;
+
+        chainHead->prev = before;
+        chainTail->next = next;
+        if (before != nullptr)
+            before->next = chainHead;
+        else
+            head = chainHead;
+        if (next != nullptr)
+            next->prev = chainTail;
+        else
+            tail = chainTail;
+    }
+};
+
+// Список с узлами из std::pmr::memory_resource (см. pmr::myvector)
+namespace pmr
+{
+    template <typename T>
+    using rawdlist = ::rawdlist<T, std::pmr::polymorphic_allocator<T>>;
+}
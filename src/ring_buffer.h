@@ -0,0 +1,584 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "bounds_check.h"
+#include "myvector.h"
+#include "write_buffer.h"
+
+// Политика "фиксированная ёмкость" для ring_buffer (вместо политики роста):
+// ёмкость задаётся конструктором или reserve, а запись в полный буфер
+// затирает самый старый элемент с противоположного конца (вставка в буфер
+// нулевой ёмкости - std::length_error). После заполнения буфер больше не
+// обращается к куче - окно последних N значений.
+struct overwrite_oldest
+{
+};
+
+// Кольцевой буфер (двусторонняя очередь на одном массиве): элементы занимают
+// length ячеек подряд, начиная с head, и при выходе за конец массива
+// продолжаются с его начала. push/pop с обоих концов - амортизированно O(1)
+// без сдвига элементов, доступ по индексу - O(1). Замена myvector в роли
+// очереди: insert(x, 0) и erase(0) у вектора сдвигают весь массив.
+//
+// Growth - политика роста ёмкости, как у myvector (growth_2x, growth_1_5x, ...),
+// или overwrite_oldest - фиксированная ёмкость с вытеснением старых элементов
+// (см. fixed_ring_buffer). При перевыделении элементы переносятся в начало
+// нового массива, итераторы становятся недействительными.
+template <typename T, typename Growth = growth_2x>
+class ring_buffer
+{
+private:
+    static constexpr bool overwrite = std::is_same<Growth, overwrite_oldest>::value;
+
+    T *buffer = nullptr;       // массив из reserved ячеек сырой памяти
+    std::size_t reserved = 0;  // ёмкость массива
+    std::size_t head = 0;      // ячейка первого элемента
+    std::size_t length = 0;    // количество элементов
+
+    // Ячейка массива для элемента с номером index (index < reserved)
+    std::size_t slot(std::size_t index) const
+    {
+        std::size_t position = head + index;
+        return position >= reserved ? position - reserved : position;
+    }
+
+    // Ячейка перед head (для push_front)
+    std::size_t before_head() const
+    {
+        return head == 0 ? reserved - 1 : head - 1;
+    }
+
+    static T *allocate(std::size_t count)
+    {
+        if (count == 0)
+            return nullptr;
+        if (count > max_size())
+            throw std::length_error("ring_buffer is too long");
+        return std::allocator<T>().allocate(count);
+    }
+
+    static void deallocate(T *ptr, std::size_t count)
+    {
+        if (ptr != nullptr)
+            std::allocator<T>().deallocate(ptr, count);
+    }
+
+    // Уничтожает элементы (память остаётся)
+    void destroy_all()
+    {
+        for (std::size_t i = 0; i < length; ++i)
+            buffer[slot(i)].~T();
+        head = 0;
+        length = 0;
+    }
+
+    // Переносит элементы в новый массив ёмкостью newCapacity (не меньше length),
+    // первый элемент - в ячейку 0. Если перемещение T может бросить исключение,
+    // элементы копируются, и при исключении старый массив остаётся целым.
+    void relocate(std::size_t newCapacity)
+    {
+        T *newBuffer = allocate(newCapacity);
+        // Занятые ячейки - два непрерывных куска: [head, ...) и начало массива
+        std::size_t first = std::min(length, reserved - head);
+        std::size_t second = length - first;
+
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            if (first > 0)
+                std::memcpy(static_cast<void *>(newBuffer), buffer + head, sizeof(T) * first);
+            if (second > 0)
+                std::memcpy(static_cast<void *>(newBuffer + first), buffer, sizeof(T) * second);
+        }
+        else
+        {
+            try
+            {
+                if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value)
+                {
+                    std::uninitialized_move(buffer + head, buffer + head + first, newBuffer);
+                    std::uninitialized_move(buffer, buffer + second, newBuffer + first);
+                }
+                else
+                {
+                    std::uninitialized_copy(buffer + head, buffer + head + first, newBuffer);
+                    try
+                    {
+                        std::uninitialized_copy(buffer, buffer + second, newBuffer + first);
+                    }
+                    catch (...)
+                    {
+                        std::destroy(newBuffer, newBuffer + first);
+                        throw;
+                    }
+                }
+            }
+            catch (...)
+            {
+                deallocate(newBuffer, newCapacity);
+                throw;
+            }
+            std::destroy(buffer + head, buffer + head + first);
+            std::destroy(buffer, buffer + second);
+        }
+
+        deallocate(buffer, reserved);
+        buffer = newBuffer;
+        reserved = newCapacity;
+        head = 0;
+    }
+
+    // Расширяет массив так, чтобы поместилось required элементов
+    void grow(std::size_t required)
+    {
+        if (required > max_size())
+            throw std::length_error("ring_buffer is too long");
+        relocate(std::min(Growth::next(reserved, required, sizeof(T)), max_size()));
+    }
+
+    // Забирает массив другого буфера, оставляя тот пустым
+    void steal(ring_buffer &other)
+    {
+        buffer = std::exchange(other.buffer, nullptr);
+        reserved = std::exchange(other.reserved, 0);
+        head = std::exchange(other.head, 0);
+        length = std::exchange(other.length, 0);
+    }
+
+    void release()
+    {
+        destroy_all();
+        deallocate(buffer, reserved);
+        buffer = nullptr;
+        reserved = 0;
+    }
+
+    // Добавление в конец: value - уже готовый объект (копия или перемещённый аргумент)
+    template <typename U>
+    void put_back(U &&value)
+    {
+        if (length == reserved)
+        {
+            if constexpr (overwrite)
+            {
+                // Самый старый элемент (в ячейке head) затирается, и ячейка становится последней
+                if (reserved == 0)
+                    throw std::length_error("ring_buffer has no capacity");
+                buffer[head] = std::forward<U>(value);
+                head = slot(1);
+                return;
+            }
+            else
+            {
+                T tmp(std::forward<U>(value)); // value может ссылаться на элемент этого же буфера
+                grow(length + 1);
+                new (buffer + slot(length)) T(std::move(tmp));
+                length++;
+                return;
+            }
+        }
+        new (buffer + slot(length)) T(std::forward<U>(value));
+        length++;
+    }
+
+    // Добавление в начало
+    template <typename U>
+    void put_front(U &&value)
+    {
+        if (length == reserved)
+        {
+            if constexpr (overwrite)
+            {
+                // Затирается самый новый элемент (в последней ячейке), и она становится первой
+                if (reserved == 0)
+                    throw std::length_error("ring_buffer has no capacity");
+                std::size_t last = slot(length - 1);
+                buffer[last] = std::forward<U>(value);
+                head = last;
+                return;
+            }
+            else
+            {
+                T tmp(std::forward<U>(value));
+                grow(length + 1);
+                std::size_t first = before_head();
+                new (buffer + first) T(std::move(tmp));
+                head = first;
+                length++;
+                return;
+            }
+        }
+        std::size_t first = before_head();
+        new (buffer + first) T(std::forward<U>(value));
+        head = first;
+        length++;
+    }
+
+public:
+    // Пустой буфер: память не выделяется до первой вставки
+    // (в режиме overwrite_oldest - до reserve)
+    ring_buffer() = default;
+
+    // Пустой буфер ёмкостью capacity. Для overwrite_oldest - окно из capacity последних элементов
+    explicit ring_buffer(std::size_t capacity)
+    {
+        reserve(capacity);
+    }
+
+    ring_buffer(std::initializer_list<T> init)
+    {
+        reserve(init.size());
+        for (const T &value : init)
+            put_back(value);
+    }
+
+    ring_buffer(ring_buffer &&other)
+    {
+        steal(other);
+    }
+
+    ~ring_buffer()
+    {
+        release();
+    }
+
+    // Move-присваивание
+    ring_buffer &operator=(ring_buffer &&other)
+    {
+        if (this == &other)
+            return *this;
+        release();
+        steal(other);
+        return *this;
+    }
+
+    // Copy-присваивание: элементы копируются в новый массив той же ёмкости
+    ring_buffer &operator=(ring_buffer &other)
+    {
+        if (this == &other)
+            return *this;
+        ring_buffer copy(other.reserved);
+        for (std::size_t i = 0; i < other.length; ++i)
+            copy.put_back(other.buffer[other.slot(i)]);
+        release();
+        steal(copy);
+        return *this;
+    }
+
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    std::size_t capacity() const
+    {
+        return reserved;
+    }
+
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Заполнен ли массив: следующая вставка перевыделит его (или затрёт старый элемент)
+    bool full() const
+    {
+        return length == reserved;
+    }
+
+    static constexpr std::size_t max_size()
+    {
+        return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(T);
+    }
+
+    // Гарантирует ёмкость не меньше count. Для overwrite_oldest - единственный
+    // способ (кроме конструктора) увеличить окно
+    void reserve(std::size_t count)
+    {
+        if (count > max_size())
+            throw std::length_error("ring_buffer is too long");
+        if (count > reserved)
+            relocate(count);
+    }
+
+    // Уменьшает ёмкость до количества элементов
+    void shrink_to_fit()
+    {
+        if (reserved > length)
+        {
+            if (length == 0)
+                release();
+            else
+                relocate(length);
+        }
+    }
+
+    // Удаляет все элементы; память остаётся
+    void clear()
+    {
+        destroy_all();
+    }
+
+    void push_back(T &value) { put_back(value); }
+    void push_back(T &&value) { put_back(std::move(value)); }
+    void push_front(T &value) { put_front(value); }
+    void push_front(T &&value) { put_front(std::move(value)); }
+
+    // Элемент конструируется из args прямо в ячейке массива (при перевыделении
+    // или затирании - отдельно, а затем переносится на место)
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        if (length == reserved)
+            put_back(T(std::forward<Args>(args)...));
+        else
+            new (buffer + slot(length++)) T(std::forward<Args>(args)...);
+        return back();
+    }
+
+    template <typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        if (length == reserved)
+        {
+            put_front(T(std::forward<Args>(args)...));
+        }
+        else
+        {
+            std::size_t first = before_head();
+            new (buffer + first) T(std::forward<Args>(args)...);
+            head = first;
+            length++;
+        }
+        return front();
+    }
+
+    // Удаление первого элемента
+    void pop_front()
+    {
+        if (length == 0)
+            throw std::out_of_range("Buffer is empty");
+        buffer[head].~T();
+        head = slot(1);
+        length--;
+        if (length == 0)
+            head = 0;
+    }
+
+    // Удаление последнего элемента
+    void pop_back()
+    {
+        if (length == 0)
+            throw std::out_of_range("Buffer is empty");
+        buffer[slot(length - 1)].~T();
+        length--;
+        if (length == 0)
+            head = 0;
+    }
+
+    // Доступ по индексу (0 - первый элемент). Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return buffer[slot(index)];
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return buffer[slot(index)];
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return buffer[slot(index)];
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return buffer[slot(index)];
+    }
+
+    // Первый и последний элементы. Пустой буфер проверяется только при LAB3_BOUNDS_CHECK
+    T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Buffer is empty");
+        return buffer[head];
+    }
+
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Buffer is empty");
+        return buffer[head];
+    }
+
+    T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Buffer is empty");
+        return buffer[slot(length - 1)];
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Buffer is empty");
+        return buffer[slot(length - 1)];
+    }
+
+    // Итератор произвольного доступа: буфер и номер элемента (не ячейки),
+    // поэтому переход через конец массива для пользователя не виден.
+    // IsConst = true - итератор только для чтения.
+    template <bool IsConst>
+    class BasicIterator
+    {
+        using owner = std::conditional_t<IsConst, const ring_buffer, ring_buffer>;
+        using element = std::conditional_t<IsConst, const T, T>;
+
+        owner *ring;         // буфер, по которому идёт обход
+        std::ptrdiff_t index; // номер текущего элемента
+
+        template <bool>
+        friend class BasicIterator;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_cv_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = element *;
+        using reference = element &;
+
+        BasicIterator() : ring(nullptr), index(0) {}
+        BasicIterator(owner *r, std::ptrdiff_t i) : ring(r), index(i) {}
+
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst> &other) : ring(other.ring), index(other.index) {}
+
+        reference operator*() const { return ring->buffer[ring->slot(static_cast<std::size_t>(index))]; }
+        pointer operator->() const { return &**this; }
+        reference get() const { return **this; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        BasicIterator &operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++index;
+            return old;
+        }
+
+        BasicIterator &operator--()
+        {
+            --index;
+            return *this;
+        }
+
+        BasicIterator operator--(int)
+        {
+            BasicIterator old = *this;
+            --index;
+            return old;
+        }
+
+        BasicIterator &operator+=(difference_type n)
+        {
+            index += n;
+            return *this;
+        }
+
+        BasicIterator &operator-=(difference_type n)
+        {
+            index -= n;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type n) { return it += n; }
+        friend BasicIterator operator+(difference_type n, BasicIterator it) { return it += n; }
+        friend BasicIterator operator-(BasicIterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const BasicIterator &a, const BasicIterator &b) { return a.index - b.index; }
+
+        friend bool operator==(const BasicIterator &a, const BasicIterator &b) { return a.index == b.index; }
+        friend bool operator!=(const BasicIterator &a, const BasicIterator &b) { return a.index != b.index; }
+        friend bool operator<(const BasicIterator &a, const BasicIterator &b) { return a.index < b.index; }
+        friend bool operator>(const BasicIterator &a, const BasicIterator &b) { return a.index > b.index; }
+        friend bool operator<=(const BasicIterator &a, const BasicIterator &b) { return a.index <= b.index; }
+        friend bool operator>=(const BasicIterator &a, const BasicIterator &b) { return a.index >= b.index; }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, static_cast<std::ptrdiff_t>(length)); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, static_cast<std::ptrdiff_t>(length)); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    // Печать всех элементов (для отладки)
+    void print() const
+    {
+        print_range(begin(), end());
+    }
+
+    // Вывод элементов через separator блоками по write_chunk_size байт
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
+    }
+};
+
+// Окно из N последних значений (телеметрия и т.п.): ёмкость задаётся один раз,
+// дальше каждая запись в полный буфер вытесняет самую старую, без обращений к куче
+template <typename T>
+using fixed_ring_buffer = ring_buffer<T, overwrite_oldest>;
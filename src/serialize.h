@@ -0,0 +1,352 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "bounds_check.h"
+#include "myvector.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LAB3_HAS_MMAP 1
+#else
+#define LAB3_HAS_MMAP 0
+#endif
+
+// Двоичный формат myvector для тривиально копируемых T: заголовок в 64 байта,
+// за ним - массив элементов как есть (байты памяти, без разбора).
+// Данные начинаются со смещения 64, поэтому в отображённом файле они выровнены
+// по 64 байтам. Файл переносим только между машинами с теми же sizeof(T) и
+// порядком байт - оба записаны в заголовке и проверяются при чтении.
+struct myvector_file_header
+{
+    char magic[8];             // "LAB3VEC"
+    std::uint32_t version;     // версия формата
+    std::uint32_t byteOrder;   // 0x01020304 в порядке байт записавшей машины
+    std::uint64_t elementSize; // sizeof(T)
+    std::uint64_t count;       // количество элементов
+    unsigned char unused[32];  // дополнение до 64 байт
+};
+
+static_assert(sizeof(myvector_file_header) == 64, "myvector file header must be 64 bytes");
+
+constexpr std::uint32_t myvector_file_version = 1;
+constexpr std::uint32_t myvector_file_byte_order = 0x01020304;
+
+// Заголовок файла для count элементов по elementSize байт
+inline myvector_file_header make_file_header(std::size_t elementSize, std::size_t count)
+{
+    myvector_file_header header{};
+    std::memcpy(header.magic, "LAB3VEC", 8);
+    header.version = myvector_file_version;
+    header.byteOrder = myvector_file_byte_order;
+    header.elementSize = elementSize;
+    header.count = count;
+    return header;
+}
+
+// Проверяет заголовок из файла path (размер файла - fileBytes) и возвращает
+// количество элементов
+inline std::size_t check_file_header(const myvector_file_header &header, std::size_t elementSize,
+                                     std::uint64_t fileBytes, const std::string &path)
+{
+    if (std::memcmp(header.magic, "LAB3VEC", 8) != 0)
+        throw std::runtime_error(path + ": not a myvector file");
+    if (header.version != myvector_file_version)
+        throw std::runtime_error(path + ": unsupported myvector file version");
+    if (header.byteOrder != myvector_file_byte_order)
+        throw std::runtime_error(path + ": myvector file has foreign byte order");
+    if (header.elementSize != elementSize)
+        throw std::runtime_error(path + ": element size mismatch");
+    if (header.count > (fileBytes - sizeof(header)) / elementSize)
+        throw std::runtime_error(path + ": myvector file is truncated");
+    return static_cast<std::size_t>(header.count);
+}
+
+// Размер открытого файла в байтах (-1 при ошибке); позиция возвращается в начало.
+// 64-битные смещения: массивы бывают больше 2 ГБ
+inline std::int64_t file_size(std::FILE *file)
+{
+#if defined(_WIN32)
+    if (_fseeki64(file, 0, SEEK_END) != 0)
+        return -1;
+    const std::int64_t bytes = _ftelli64(file);
+    if (_fseeki64(file, 0, SEEK_SET) != 0)
+        return -1;
+#else
+    if (fseeko(file, 0, SEEK_END) != 0)
+        return -1;
+    const std::int64_t bytes = ftello(file);
+    if (fseeko(file, 0, SEEK_SET) != 0)
+        return -1;
+#endif
+    return bytes;
+}
+
+// Записывает вектор в файл path (перезаписывая его) одним блоком
+template <typename T, std::size_t Inline, typename Growth, typename Alloc>
+void save_binary(const myvector<T, Inline, Growth, Alloc> &vect, const std::string &path)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "save_binary needs a trivially copyable T");
+
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr)
+        throw std::runtime_error(path + ": cannot open for writing");
+
+    const myvector_file_header header = make_file_header(sizeof(T), vect.size());
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && vect.size() > 0)
+        ok = std::fwrite(vect.data(), sizeof(T), vect.size(), file) == vect.size();
+    // fclose сбрасывает буфер - его ошибка тоже означает неполную запись
+    if (std::fclose(file) != 0)
+        ok = false;
+    if (!ok)
+        throw std::runtime_error(path + ": write failed");
+}
+
+// Читает вектор из файла path, записанного save_binary: старое содержимое
+// заменяется, элементы читаются прямо в массив вектора одним блоком
+template <typename T, std::size_t Inline, typename Growth, typename Alloc>
+void load_binary(myvector<T, Inline, Growth, Alloc> &vect, const std::string &path)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "load_binary needs a trivially copyable T");
+
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        throw std::runtime_error(path + ": cannot open for reading");
+
+    try
+    {
+        // Размер файла нужен, чтобы повреждённый count не заставил выделить гигабайты
+        const std::int64_t fileBytes = file_size(file);
+        myvector_file_header header;
+        if (fileBytes < static_cast<std::int64_t>(sizeof(header)) || std::fread(&header, sizeof(header), 1, file) != 1)
+            throw std::runtime_error(path + ": not a myvector file");
+        const std::size_t count = check_file_header(header, sizeof(T), static_cast<std::uint64_t>(fileBytes), path);
+
+        // Старые элементы не копируются при перевыделении, новые не обнуляются:
+        // единственная запись в массив - сам fread
+        vect.resize(0);
+        vect.reserve(count);
+        vect.resize_for_overwrite(count);
+        if (count > 0 && std::fread(vect.data(), sizeof(T), count, file) != count)
+        {
+            vect.resize(0);
+            throw std::runtime_error(path + ": read failed");
+        }
+    }
+    catch (...)
+    {
+        std::fclose(file);
+        throw;
+    }
+    std::fclose(file);
+}
+
+// Режим отображения файла
+enum class map_mode
+{
+    read_only,     // только чтение: страницы общие с кэшем файла
+    copy_on_write, // запись разрешена: изменённые страницы копируются, файл не меняется
+};
+
+// Вектор из файла save_binary без копирования: файл отображается в память
+// (mmap), элементы читаются прямо со страниц файла, которые ОС подгружает по
+// первому обращению. Запуск не ждёт чтения всего массива, а несколько процессов,
+// открывших один файл только для чтения, делят одни и те же страницы.
+//
+// Режим - параметр шаблона: в read_only (по умолчанию) все обращения к
+// элементам дают const T - страницы отображены только для чтения, и запись в
+// них завершила бы процесс. Изменяемые элементы - только в copy_on_write.
+// Где mmap недоступен, файл целиком читается в память - интерфейс тот же.
+template <typename T, map_mode Mode = map_mode::read_only>
+class mapped_myvector
+{
+    static_assert(std::is_trivially_copyable<T>::value, "mapped_myvector needs a trivially copyable T");
+    static_assert(alignof(T) <= sizeof(myvector_file_header), "element alignment exceeds data offset");
+
+private:
+    void *base = nullptr;   // начало отображения (или прочитанного буфера)
+    std::size_t bytes = 0;  // его размер
+    T *items = nullptr;     // первый элемент: base + 64
+    std::size_t length = 0; // количество элементов
+
+    // Освобождает отображение
+    void release()
+    {
+        if (base == nullptr)
+            return;
+#if LAB3_HAS_MMAP
+        ::munmap(base, bytes);
+#else
+        ::operator delete(base, std::align_val_t(sizeof(myvector_file_header)));
+#endif
+        base = nullptr;
+        items = nullptr;
+        bytes = 0;
+        length = 0;
+    }
+
+    // Забирает отображение другого объекта
+    void steal(mapped_myvector &view)
+    {
+        base = std::exchange(view.base, nullptr);
+        bytes = std::exchange(view.bytes, 0);
+        items = std::exchange(view.items, nullptr);
+        length = std::exchange(view.length, 0);
+    }
+
+public:
+    // Тип элементов при неконстантном доступе: T только при copy_on_write
+    using element_type = std::conditional_t<Mode == map_mode::copy_on_write, T, const T>;
+    using value_type = T;
+
+    // Отображает файл path, записанный save_binary
+    explicit mapped_myvector(const std::string &path)
+    {
+#if LAB3_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error(path + ": cannot open for reading");
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || static_cast<std::uint64_t>(info.st_size) < sizeof(myvector_file_header))
+        {
+            ::close(fd);
+            throw std::runtime_error(path + ": not a myvector file");
+        }
+        bytes = static_cast<std::size_t>(info.st_size);
+
+        // MAP_PRIVATE в обоих режимах: с PROT_WRITE это и есть копирование при записи
+        const int protection = Mode == map_mode::copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ;
+        void *mapping = ::mmap(nullptr, bytes, protection, MAP_PRIVATE, fd, 0);
+        ::close(fd); // отображение держит файл само
+        if (mapping == MAP_FAILED)
+            throw std::runtime_error(path + ": mmap failed");
+        base = mapping;
+#else
+        std::FILE *file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr)
+            throw std::runtime_error(path + ": cannot open for reading");
+        const std::int64_t fileBytes = file_size(file);
+        if (fileBytes < static_cast<std::int64_t>(sizeof(myvector_file_header)))
+        {
+            std::fclose(file);
+            throw std::runtime_error(path + ": not a myvector file");
+        }
+        bytes = static_cast<std::size_t>(fileBytes);
+        base = ::operator new(bytes, std::align_val_t(sizeof(myvector_file_header)));
+        const bool ok = std::fread(base, 1, bytes, file) == bytes;
+        std::fclose(file);
+        if (!ok)
+        {
+            release();
+            throw std::runtime_error(path + ": read failed");
+        }
+#endif
+
+        try
+        {
+            myvector_file_header header;
+            std::memcpy(&header, base, sizeof(header));
+            length = check_file_header(header, sizeof(T), bytes, path);
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+        items = reinterpret_cast<T *>(static_cast<unsigned char *>(base) + sizeof(myvector_file_header));
+    }
+
+    // Отображение нельзя копировать, только переносить
+    mapped_myvector(const mapped_myvector &) = delete;
+    mapped_myvector &operator=(const mapped_myvector &) = delete;
+
+    mapped_myvector(mapped_myvector &&view)
+    {
+        steal(view);
+    }
+
+    mapped_myvector &operator=(mapped_myvector &&view)
+    {
+        if (this != &view)
+        {
+            release();
+            steal(view);
+        }
+        return *this;
+    }
+
+    ~mapped_myvector()
+    {
+        release();
+    }
+
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    element_type &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return items[index];
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return items[index];
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    element_type &at(std::size_t index)
+    {
+        check_index(index, length);
+        return items[index];
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return items[index];
+    }
+
+    // Элементы - непрерывный массив, итераторы - указатели
+    element_type *data() { return items; }
+    const T *data() const { return items; }
+
+    element_type *begin() { return items; }
+    element_type *end() { return items + length; }
+    const T *begin() const { return items; }
+    const T *end() const { return items + length; }
+    const T *cbegin() const { return items; }
+    const T *cend() const { return items + length; }
+
+    // Копия в обычный myvector (когда нужен изменяемый вектор с ростом)
+    myvector<T> to_myvector() const
+    {
+        return myvector<T>(items, items + length);
+    }
+};
+
+// Отображение с изменяемыми элементами (изменения не попадают в файл)
+template <typename T>
+using writable_mapped_myvector = mapped_myvector<T, map_mode::copy_on_write>;
@@ -0,0 +1,588 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+// Векторные ядра поиска и свёртки для непрерывных массивов int32_t и float:
+// find, count, min_max, sum. Набор ядер выбирается один раз, при первом
+// обращении, по возможностям процессора: AVX-512F или AVX2 на x86 (GCC/Clang),
+// NEON на AArch64, иначе - скалярные циклы. Переменная окружения LAB3_SIMD
+// (scalar, avx2, avx512, neon) позволяет выбрать набор ниже доступного - для
+// сравнения и отладки.
+//
+// Ядро читает массив выровненными загрузками: начало до границы вектора и
+// хвост короче блока обрабатываются скалярно (у aligned_myvector начала нет).
+// Для остальных арифметических типов вызовы идут в стандартные алгоритмы.
+//
+// float: сумма складывается по дорожкам вектора, поэтому может отличаться от
+// последовательной в последних знаках; min_max для массива с NaN не определён.
+
+// GCC: векторы в обобщённых ядрах (без target) предупреждают о смене ABI, хотя
+// ядра только встраиваются; а заголовки AVX-512 GCC 12 ложно сообщают о
+// неинициализированном __Y (PR 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LAB3_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define LAB3_SIMD_X86 0
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define LAB3_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define LAB3_SIMD_NEON 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LAB3_SIMD_INLINE inline __attribute__((always_inline))
+#else
+#define LAB3_SIMD_INLINE inline
+#endif
+
+// Тип суммы: целые расширяются до 64 бит, вещественные остаются собой
+template <typename T, bool = std::is_integral<T>::value>
+struct simd_sum
+{
+    using type = T;
+};
+
+template <typename T>
+struct simd_sum<T, true>
+{
+    using type = std::conditional_t<std::is_signed<T>::value, std::int64_t, std::uint64_t>;
+};
+
+template <typename T>
+using simd_sum_t = typename simd_sum<T>::type;
+
+// Есть ли для T векторные ядра
+template <typename T>
+constexpr bool simd_supported = std::is_same<T, std::int32_t>::value || std::is_same<T, float>::value;
+
+// Набор ядер для T. Ядро получает массив, выровненный по alignment байт,
+// длиной кратной block, и для find/count возвращает номер/количество в нём
+template <typename T>
+struct simd_kernel_set
+{
+    std::size_t (*find)(const T *data, std::size_t n, T value);   // n, если не найдено
+    std::size_t (*count)(const T *data, std::size_t n, T value);
+    void (*min_max)(const T *data, std::size_t n, T &lo, T &hi); // n > 0
+    simd_sum_t<T> (*sum)(const T *data, std::size_t n);
+    std::size_t alignment; // выравнивание загрузок, байт
+    std::size_t block;     // элементов за итерацию
+    const char *name;      // "avx512", "avx2", "neon" или "scalar"
+};
+
+// Обобщённые ядра: Ops - векторные операции одного набора инструкций.
+// Встраиваются в обёртку с нужным target, поэтому сами его не указывают
+// (и нужны только компиляторам с векторными наборами - GCC/Clang).
+
+// Блок ядер - 4 вектора: независимые сравнения и накопители выполняются параллельно
+constexpr std::size_t simd_unroll = 4;
+
+#if LAB3_SIMD_X86 || LAB3_SIMD_NEON
+template <typename Ops, typename T>
+LAB3_SIMD_INLINE std::size_t kernel_find(const T *data, std::size_t n, T value)
+{
+    const typename Ops::vec key = Ops::broadcast(value);
+    for (std::size_t i = 0; i < n; i += Ops::lanes * simd_unroll)
+    {
+        std::uint64_t mask = 0;
+        for (std::size_t k = 0; k < simd_unroll; ++k)
+            mask |= std::uint64_t(Ops::equal(Ops::load(data + i + k * Ops::lanes), key)) << (k * Ops::lanes);
+        if (mask != 0)
+            return i + static_cast<std::size_t>(__builtin_ctzll(mask));
+    }
+    return n;
+}
+
+template <typename Ops, typename T>
+LAB3_SIMD_INLINE std::size_t kernel_count(const T *data, std::size_t n, T value)
+{
+    const typename Ops::vec key = Ops::broadcast(value);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; i += Ops::lanes * simd_unroll)
+    {
+        for (std::size_t k = 0; k < simd_unroll; ++k)
+            total += static_cast<std::size_t>(__builtin_popcount(Ops::equal(Ops::load(data + i + k * Ops::lanes), key)));
+    }
+    return total;
+}
+
+template <typename Ops, typename T>
+LAB3_SIMD_INLINE void kernel_min_max(const T *data, std::size_t n, T &lo, T &hi)
+{
+    typename Ops::vec low[simd_unroll], high[simd_unroll];
+    for (std::size_t k = 0; k < simd_unroll; ++k)
+        low[k] = high[k] = Ops::load(data + k * Ops::lanes);
+    for (std::size_t i = Ops::lanes * simd_unroll; i < n; i += Ops::lanes * simd_unroll)
+    {
+        for (std::size_t k = 0; k < simd_unroll; ++k)
+        {
+            typename Ops::vec v = Ops::load(data + i + k * Ops::lanes);
+            low[k] = Ops::min(low[k], v);
+            high[k] = Ops::max(high[k], v);
+        }
+    }
+    for (std::size_t k = 1; k < simd_unroll; ++k)
+    {
+        low[0] = Ops::min(low[0], low[k]);
+        high[0] = Ops::max(high[0], high[k]);
+    }
+
+    alignas(64) T lanesLow[Ops::lanes];
+    alignas(64) T lanesHigh[Ops::lanes];
+    Ops::store(lanesLow, low[0]);
+    Ops::store(lanesHigh, high[0]);
+    lo = lanesLow[0];
+    hi = lanesHigh[0];
+    for (std::size_t k = 1; k < Ops::lanes; ++k)
+    {
+        lo = std::min(lo, lanesLow[k]);
+        hi = std::max(hi, lanesHigh[k]);
+    }
+}
+
+template <typename Ops, typename T>
+LAB3_SIMD_INLINE simd_sum_t<T> kernel_sum(const T *data, std::size_t n)
+{
+    typename Ops::acc acc[simd_unroll];
+    for (std::size_t k = 0; k < simd_unroll; ++k)
+        acc[k] = Ops::acc_zero();
+    for (std::size_t i = 0; i < n; i += Ops::lanes * simd_unroll)
+    {
+        for (std::size_t k = 0; k < simd_unroll; ++k)
+            acc[k] = Ops::accumulate(acc[k], Ops::load(data + i + k * Ops::lanes));
+    }
+
+    simd_sum_t<T> total = 0;
+    alignas(64) simd_sum_t<T> lanes[Ops::accLanes];
+    for (std::size_t k = 0; k < simd_unroll; ++k)
+    {
+        Ops::acc_store(lanes, acc[k]);
+        for (std::size_t j = 0; j < Ops::accLanes; ++j)
+            total += lanes[j];
+    }
+    return total;
+}
+
+#endif
+
+// Скалярные ядра (и обработка начала/хвоста массива)
+
+template <typename T>
+std::size_t scalar_find(const T *data, std::size_t n, T value)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (data[i] == value)
+            return i;
+    }
+    return n;
+}
+
+template <typename T>
+std::size_t scalar_count(const T *data, std::size_t n, T value)
+{
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; ++i)
+        total += data[i] == value;
+    return total;
+}
+
+template <typename T>
+void scalar_min_max(const T *data, std::size_t n, T &lo, T &hi)
+{
+    lo = hi = data[0];
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        lo = std::min(lo, data[i]);
+        hi = std::max(hi, data[i]);
+    }
+}
+
+template <typename T>
+simd_sum_t<T> scalar_sum(const T *data, std::size_t n)
+{
+    simd_sum_t<T> total = 0;
+    for (std::size_t i = 0; i < n; ++i)
+        total += data[i];
+    return total;
+}
+
+template <typename T>
+constexpr simd_kernel_set<T> scalar_kernels = {scalar_find<T>, scalar_count<T>, scalar_min_max<T>, scalar_sum<T>,
+                                               alignof(T), 1, "scalar"};
+
+#if LAB3_SIMD_X86
+#define LAB3_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define LAB3_TARGET_AVX512 __attribute__((target("avx512f,popcnt")))
+
+template <typename T>
+struct avx2_ops;
+
+template <>
+struct avx2_ops<std::int32_t>
+{
+    using vec = __m256i;
+    using acc = __m256i; // 4 x int64
+    static constexpr std::size_t lanes = 8;
+    static constexpr std::size_t accLanes = 4;
+
+    LAB3_TARGET_AVX2 static vec load(const std::int32_t *p) { return _mm256_load_si256(reinterpret_cast<const __m256i *>(p)); }
+    LAB3_TARGET_AVX2 static void store(std::int32_t *p, vec v) { _mm256_store_si256(reinterpret_cast<__m256i *>(p), v); }
+    LAB3_TARGET_AVX2 static vec broadcast(std::int32_t v) { return _mm256_set1_epi32(v); }
+    LAB3_TARGET_AVX2 static std::uint32_t equal(vec a, vec b)
+    {
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+    LAB3_TARGET_AVX2 static vec min(vec a, vec b) { return _mm256_min_epi32(a, b); }
+    LAB3_TARGET_AVX2 static vec max(vec a, vec b) { return _mm256_max_epi32(a, b); }
+    LAB3_TARGET_AVX2 static acc acc_zero() { return _mm256_setzero_si256(); }
+    LAB3_TARGET_AVX2 static acc accumulate(acc s, vec v)
+    {
+        s = _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        return _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    LAB3_TARGET_AVX2 static void acc_store(std::int64_t *p, acc s) { _mm256_store_si256(reinterpret_cast<__m256i *>(p), s); }
+};
+
+template <>
+struct avx2_ops<float>
+{
+    using vec = __m256;
+    using acc = __m256;
+    static constexpr std::size_t lanes = 8;
+    static constexpr std::size_t accLanes = 8;
+
+    LAB3_TARGET_AVX2 static vec load(const float *p) { return _mm256_load_ps(p); }
+    LAB3_TARGET_AVX2 static void store(float *p, vec v) { _mm256_store_ps(p, v); }
+    LAB3_TARGET_AVX2 static vec broadcast(float v) { return _mm256_set1_ps(v); }
+    LAB3_TARGET_AVX2 static std::uint32_t equal(vec a, vec b)
+    {
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+    LAB3_TARGET_AVX2 static vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+    LAB3_TARGET_AVX2 static vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+    LAB3_TARGET_AVX2 static acc acc_zero() { return _mm256_setzero_ps(); }
+    LAB3_TARGET_AVX2 static acc accumulate(acc s, vec v) { return _mm256_add_ps(s, v); }
+    LAB3_TARGET_AVX2 static void acc_store(float *p, acc s) { _mm256_store_ps(p, s); }
+};
+
+template <typename T>
+struct avx512_ops;
+
+template <>
+struct avx512_ops<std::int32_t>
+{
+    using vec = __m512i;
+    using acc = __m512i; // 8 x int64
+    static constexpr std::size_t lanes = 16;
+    static constexpr std::size_t accLanes = 8;
+
+    LAB3_TARGET_AVX512 static vec load(const std::int32_t *p) { return _mm512_load_si512(p); }
+    LAB3_TARGET_AVX512 static void store(std::int32_t *p, vec v) { _mm512_store_si512(p, v); }
+    LAB3_TARGET_AVX512 static vec broadcast(std::int32_t v) { return _mm512_set1_epi32(v); }
+    LAB3_TARGET_AVX512 static std::uint32_t equal(vec a, vec b) { return _mm512_cmpeq_epi32_mask(a, b); }
+    LAB3_TARGET_AVX512 static vec min(vec a, vec b) { return _mm512_min_epi32(a, b); }
+    LAB3_TARGET_AVX512 static vec max(vec a, vec b) { return _mm512_max_epi32(a, b); }
+    LAB3_TARGET_AVX512 static acc acc_zero() { return _mm512_setzero_si512(); }
+    LAB3_TARGET_AVX512 static acc accumulate(acc s, vec v)
+    {
+        s = _mm512_add_epi64(s, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v)));
+        return _mm512_add_epi64(s, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1)));
+    }
+    LAB3_TARGET_AVX512 static void acc_store(std::int64_t *p, acc s) { _mm512_store_si512(p, s); }
+};
+
+template <>
+struct avx512_ops<float>
+{
+    using vec = __m512;
+    using acc = __m512;
+    static constexpr std::size_t lanes = 16;
+    static constexpr std::size_t accLanes = 16;
+
+    LAB3_TARGET_AVX512 static vec load(const float *p) { return _mm512_load_ps(p); }
+    LAB3_TARGET_AVX512 static void store(float *p, vec v) { _mm512_store_ps(p, v); }
+    LAB3_TARGET_AVX512 static vec broadcast(float v) { return _mm512_set1_ps(v); }
+    LAB3_TARGET_AVX512 static std::uint32_t equal(vec a, vec b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    LAB3_TARGET_AVX512 static vec min(vec a, vec b) { return _mm512_min_ps(a, b); }
+    LAB3_TARGET_AVX512 static vec max(vec a, vec b) { return _mm512_max_ps(a, b); }
+    LAB3_TARGET_AVX512 static acc acc_zero() { return _mm512_setzero_ps(); }
+    LAB3_TARGET_AVX512 static acc accumulate(acc s, vec v) { return _mm512_add_ps(s, v); }
+    LAB3_TARGET_AVX512 static void acc_store(float *p, acc s) { _mm512_store_ps(p, s); }
+};
+
+// Точки входа с нужным target: обобщённое ядро встраивается и компилируется под AVX2/AVX-512
+
+template <typename T>
+LAB3_TARGET_AVX2 std::size_t avx2_find(const T *data, std::size_t n, T value) { return kernel_find<avx2_ops<T>>(data, n, value); }
+template <typename T>
+LAB3_TARGET_AVX2 std::size_t avx2_count(const T *data, std::size_t n, T value) { return kernel_count<avx2_ops<T>>(data, n, value); }
+template <typename T>
+LAB3_TARGET_AVX2 void avx2_min_max(const T *data, std::size_t n, T &lo, T &hi) { kernel_min_max<avx2_ops<T>>(data, n, lo, hi); }
+template <typename T>
+LAB3_TARGET_AVX2 simd_sum_t<T> avx2_sum(const T *data, std::size_t n) { return kernel_sum<avx2_ops<T>>(data, n); }
+
+template <typename T>
+LAB3_TARGET_AVX512 std::size_t avx512_find(const T *data, std::size_t n, T value) { return kernel_find<avx512_ops<T>>(data, n, value); }
+template <typename T>
+LAB3_TARGET_AVX512 std::size_t avx512_count(const T *data, std::size_t n, T value) { return kernel_count<avx512_ops<T>>(data, n, value); }
+template <typename T>
+LAB3_TARGET_AVX512 void avx512_min_max(const T *data, std::size_t n, T &lo, T &hi) { kernel_min_max<avx512_ops<T>>(data, n, lo, hi); }
+template <typename T>
+LAB3_TARGET_AVX512 simd_sum_t<T> avx512_sum(const T *data, std::size_t n) { return kernel_sum<avx512_ops<T>>(data, n); }
+
+template <typename T>
+constexpr simd_kernel_set<T> avx2_kernels = {avx2_find<T>, avx2_count<T>, avx2_min_max<T>, avx2_sum<T>,
+                                             32, avx2_ops<T>::lanes * simd_unroll, "avx2"};
+template <typename T>
+constexpr simd_kernel_set<T> avx512_kernels = {avx512_find<T>, avx512_count<T>, avx512_min_max<T>, avx512_sum<T>,
+                                               64, avx512_ops<T>::lanes * simd_unroll, "avx512"};
+#endif
+
+#if LAB3_SIMD_NEON
+template <typename T>
+struct neon_ops;
+
+template <>
+struct neon_ops<std::int32_t>
+{
+    using vec = int32x4_t;
+    using acc = int64x2_t;
+    static constexpr std::size_t lanes = 4;
+    static constexpr std::size_t accLanes = 2;
+
+    static vec load(const std::int32_t *p) { return vld1q_s32(p); }
+    static void store(std::int32_t *p, vec v) { vst1q_s32(p, v); }
+    static vec broadcast(std::int32_t v) { return vdupq_n_s32(v); }
+    static std::uint32_t equal(vec a, vec b)
+    {
+        // Дорожка i даёт бит i: сравнение (все единицы) AND 1 << i, затем сумма дорожек
+        const uint32x4_t bits = {1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(vceqq_s32(a, b), bits));
+    }
+    static vec min(vec a, vec b) { return vminq_s32(a, b); }
+    static vec max(vec a, vec b) { return vmaxq_s32(a, b); }
+    static acc acc_zero() { return vdupq_n_s64(0); }
+    static acc accumulate(acc s, vec v) { return vpadalq_s32(s, v); }
+    static void acc_store(std::int64_t *p, acc s) { vst1q_s64(p, s); }
+};
+
+template <>
+struct neon_ops<float>
+{
+    using vec = float32x4_t;
+    using acc = float32x4_t;
+    static constexpr std::size_t lanes = 4;
+    static constexpr std::size_t accLanes = 4;
+
+    static vec load(const float *p) { return vld1q_f32(p); }
+    static void store(float *p, vec v) { vst1q_f32(p, v); }
+    static vec broadcast(float v) { return vdupq_n_f32(v); }
+    static std::uint32_t equal(vec a, vec b)
+    {
+        const uint32x4_t bits = {1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(vceqq_f32(a, b), bits));
+    }
+    static vec min(vec a, vec b) { return vminq_f32(a, b); }
+    static vec max(vec a, vec b) { return vmaxq_f32(a, b); }
+    static acc acc_zero() { return vdupq_n_f32(0.0f); }
+    static acc accumulate(acc s, vec v) { return vaddq_f32(s, v); }
+    static void acc_store(float *p, acc s) { vst1q_f32(p, s); }
+};
+
+template <typename T>
+std::size_t neon_find(const T *data, std::size_t n, T value) { return kernel_find<neon_ops<T>>(data, n, value); }
+template <typename T>
+std::size_t neon_count(const T *data, std::size_t n, T value) { return kernel_count<neon_ops<T>>(data, n, value); }
+template <typename T>
+void neon_min_max(const T *data, std::size_t n, T &lo, T &hi) { kernel_min_max<neon_ops<T>>(data, n, lo, hi); }
+template <typename T>
+simd_sum_t<T> neon_sum(const T *data, std::size_t n) { return kernel_sum<neon_ops<T>>(data, n); }
+
+template <typename T>
+constexpr simd_kernel_set<T> neon_kernels = {neon_find<T>, neon_count<T>, neon_min_max<T>, neon_sum<T>,
+                                             16, neon_ops<T>::lanes * simd_unroll, "neon"};
+#endif
+
+// Выбор ядер: лучший набор, который поддерживает процессор (и не выше LAB3_SIMD)
+template <typename T>
+simd_kernel_set<T> select_kernels()
+{
+    const char *limit = std::getenv("LAB3_SIMD");
+    auto allowed = [limit](const char *name)
+    {
+        if (limit == nullptr)
+            return true;
+        // Порядок наборов от слабого к сильному
+        static const char *const order[] = {"scalar", "neon", "avx2", "avx512"};
+        int asked = -1, wanted = -1;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (std::strcmp(order[i], limit) == 0)
+                asked = i;
+            if (std::strcmp(order[i], name) == 0)
+                wanted = i;
+        }
+        return asked < 0 || wanted <= asked;
+    };
+
+#if LAB3_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && allowed("avx512"))
+        return avx512_kernels<T>;
+    if (__builtin_cpu_supports("avx2") && allowed("avx2"))
+        return avx2_kernels<T>;
+#endif
+#if LAB3_SIMD_NEON
+    if (allowed("neon"))
+        return neon_kernels<T>;
+#endif
+    static_cast<void>(allowed);
+    return scalar_kernels<T>;
+}
+
+// Выбранный набор ядер для T (выбирается при первом вызове)
+template <typename T>
+const simd_kernel_set<T> &simd_kernels()
+{
+    static const simd_kernel_set<T> selected = select_kernels<T>();
+    return selected;
+}
+
+// Деление [0, n) на скалярное начало (до выравнивания), тело из целых блоков и хвост
+struct simd_split
+{
+    std::size_t head;
+    std::size_t body;
+};
+
+template <typename T>
+simd_split split_for(const T *data, std::size_t n, const simd_kernel_set<T> &kernels)
+{
+    std::size_t misalign = reinterpret_cast<std::uintptr_t>(data) % kernels.alignment;
+    std::size_t head = misalign == 0 ? 0 : (kernels.alignment - misalign) / sizeof(T);
+    head = std::min(head, n);
+    std::size_t body = (n - head) / kernels.block * kernels.block;
+    return simd_split{head, body};
+}
+
+// Номер первого элемента, равного value, или n
+template <typename T>
+std::size_t simd_find(const T *data, std::size_t n, const T &value)
+{
+    if constexpr (simd_supported<T>)
+    {
+        const simd_kernel_set<T> &kernels = simd_kernels<T>();
+        simd_split part = split_for(data, n, kernels);
+        std::size_t found = scalar_find(data, part.head, value);
+        if (found < part.head)
+            return found;
+        found = kernels.find(data + part.head, part.body, value);
+        if (found < part.body)
+            return part.head + found;
+        std::size_t done = part.head + part.body;
+        return done + scalar_find(data + done, n - done, value);
+    }
+    else
+    {
+        return static_cast<std::size_t>(std::find(data, data + n, value) - data);
+    }
+}
+
+// Количество элементов, равных value
+template <typename T>
+std::size_t simd_count(const T *data, std::size_t n, const T &value)
+{
+    if constexpr (simd_supported<T>)
+    {
+        const simd_kernel_set<T> &kernels = simd_kernels<T>();
+        simd_split part = split_for(data, n, kernels);
+        std::size_t done = part.head + part.body;
+        return scalar_count(data, part.head, value) + kernels.count(data + part.head, part.body, value) +
+               scalar_count(data + done, n - done, value);
+    }
+    else
+    {
+        return static_cast<std::size_t>(std::count(data, data + n, value));
+    }
+}
+
+// Наименьший и наибольший элементы (n > 0)
+template <typename T>
+std::pair<T, T> simd_min_max(const T *data, std::size_t n)
+{
+    if constexpr (simd_supported<T>)
+    {
+        const simd_kernel_set<T> &kernels = simd_kernels<T>();
+        simd_split part = split_for(data, n, kernels);
+        T lo = data[0], hi = data[0];
+        auto merge = [&lo, &hi](T partLow, T partHigh)
+        {
+            lo = std::min(lo, partLow);
+            hi = std::max(hi, partHigh);
+        };
+
+        T partLow, partHigh;
+        if (part.head > 0)
+        {
+            scalar_min_max(data, part.head, partLow, partHigh);
+            merge(partLow, partHigh);
+        }
+        if (part.body > 0)
+        {
+            kernels.min_max(data + part.head, part.body, partLow, partHigh);
+            merge(partLow, partHigh);
+        }
+        std::size_t done = part.head + part.body;
+        if (done < n)
+        {
+            scalar_min_max(data + done, n - done, partLow, partHigh);
+            merge(partLow, partHigh);
+        }
+        return {lo, hi};
+    }
+    else
+    {
+        auto range = std::minmax_element(data, data + n);
+        return {*range.first, *range.second};
+    }
+}
+
+// Сумма элементов (целые - в 64-битном накопителе)
+template <typename T>
+simd_sum_t<T> simd_sum_of(const T *data, std::size_t n)
+{
+    static_assert(std::is_arithmetic<T>::value, "sum() needs an arithmetic element type");
+    if constexpr (simd_supported<T>)
+    {
+        const simd_kernel_set<T> &kernels = simd_kernels<T>();
+        simd_split part = split_for(data, n, kernels);
+        std::size_t done = part.head + part.body;
+        return scalar_sum(data, part.head) + kernels.sum(data + part.head, part.body) +
+               scalar_sum(data + done, n - done);
+    }
+    else
+    {
+        return std::accumulate(data, data + n, simd_sum_t<T>(0));
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
@@ -3,151 +3,400 @@
 #include <iostream>
 #include <utility>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <initializer_list>
+#include <functional>
+#include "bounds_check.h"
+#include "write_buffer.h"
+#include "stats.h"
+#include "list_algorithms.h"
+
+// Удалитель узла для unique_ptr: уничтожает узел и возвращает память аллокатору.
+// Аллокатор без состояния (std::allocator) не хранится - unique_ptr остаётся
+// размером с указатель.
+template <typename NodeT, typename NodeAlloc,
+          bool Stateless = std::allocator_traits<NodeAlloc>::is_always_equal::value &&
+                           std::is_default_constructible<NodeAlloc>::value>
+struct NodeDeleter
+{
+    NodeDeleter() = default;
+    NodeDeleter(const NodeAlloc &) {}
+
+    void operator()(NodeT *ptr) const
+    {
+        NodeAlloc alloc;
+        std::allocator_traits<NodeAlloc>::destroy(alloc, ptr);
+        std::allocator_traits<NodeAlloc>::deallocate(alloc, ptr, 1);
+        stats_free(container_kind::slist, sizeof(NodeT));
+    }
+};
+
+// Аллокатор с состоянием (например, pool_allocator) копируется в удалитель каждого
+// узла: память узла возвращается туда, откуда была взята, кому бы узел ни достался.
+template <typename NodeT, typename NodeAlloc>
+struct NodeDeleter<NodeT, NodeAlloc, false>
+{
+    // Аллокатор лежит в union, чтобы при присваивании пересоздавать его на месте:
+    // не у всех аллокаторов есть operator= (у std::pmr::polymorphic_allocator его нет)
+    union
+    {
+        NodeAlloc alloc;
+    };
+
+    NodeDeleter() { new (&alloc) NodeAlloc(); }
+    NodeDeleter(const NodeAlloc &source) { new (&alloc) NodeAlloc(source); }
+    NodeDeleter(const NodeDeleter &other) { new (&alloc) NodeAlloc(other.alloc); }
+
+    NodeDeleter &operator=(const NodeDeleter &other)
+    {
+        if (this != &other)
+        {
+            alloc.~NodeAlloc();
+            new (&alloc) NodeAlloc(other.alloc);
+        }
+        return *this;
+    }
+
+    ~NodeDeleter() { alloc.~NodeAlloc(); }
+
+    void operator()(NodeT *ptr)
+    {
+        std::allocator_traits<NodeAlloc>::destroy(alloc, ptr);
+        std::allocator_traits<NodeAlloc>::deallocate(alloc, ptr, 1);
+        stats_free(container_kind::slist, sizeof(NodeT));
+    }
+};
 
 // Узел односвязного списка.
 // Хранит значение и уникальны указатель на следующий узел.
 // У каждого узла - ровно один владелец: либо предыдущий узел, либо head списка.
-template <typename T>
+// Alloc - аллокатор списка; узел выделяется его копией, перепривязанной на Node.
+template <typename T, typename Alloc = std::allocator<T>>
 struct Node
 {
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using deleter = NodeDeleter<Node, node_allocator>;
+    using pointer = std::unique_ptr<Node, deleter>;
+
     T value;
-    std::unique_ptr<Node<T>> next; // владеет следующим узлом (или nullptr)
+    pointer next; // владеет следующим узлом (или nullptr)
 
     // Конструктор для lvalue: копируем значение
-    Node(T &val)
-    {
-        value = val;
-        next = nullptr; // явно обнуляем (хотя unique_ptr и так nullptr по умолчанию)
-    }
+    Node(const T &val) : value(val), next(nullptr) {}
 
     // Конструктор для rvalue: перемещаем значение, если возможно
-    Node(T &&val)
-    {
-        value = std::move(val);
-        next = nullptr;
-    }
+    Node(T &&val) : value(std::move(val)), next(nullptr) {}
+
+    // Конструирование значения на месте из аргументов его конструктора (для emplace)
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args &&...args) : value(std::forward<Args>(args)...), next(nullptr) {}
 };
 
 // Односвязный список на unique_ptr - более "лёгкий" и эффективный,
 // чем shared_ptr-версия, но без обратной связи (prev).
-template <typename T>
+// Узлы выделяются через Alloc; с pool_allocator (node_pool.h) они нарезаются
+// из общих блоков и переиспользуются после erase.
+template <typename T, typename Alloc = std::allocator<T>>
 class slist
 {
 private:
-    std::unique_ptr<Node<T>> head; // владеет первым узлом (или nullptr)
-    int length;                    // количество элементов
-
-public:
-    // Пустой список
-    slist()
+    using node_type = Node<T, Alloc>;
+    using node_pointer = typename node_type::pointer;
+    using node_allocator = typename node_type::node_allocator;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc; // аллокатор узлов
+    node_pointer head;    // владеет первым узлом (или nullptr)
+    node_type *tail;      // последний узел (не владеет), nullptr если список пуст
+    std::size_t length;   // количество элементов
+
+    // Создаёт узел через аллокатор списка; значение строится прямо в узле из args.
+    // Удалитель unique_ptr вернёт память туда же
+    template <typename... Args>
+    node_pointer make_node(Args &&...args)
     {
-        head = nullptr;
-        length = 0;
+        node_type *raw = node_traits::allocate(alloc, 1);
+        try
+        {
+            node_traits::construct(alloc, raw, std::in_place, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(alloc, raw, 1);
+            throw;
+        }
+        stats_alloc(container_kind::slist, sizeof(node_type));
+        return node_pointer(raw, typename node_type::deleter(alloc));
     }
 
-    // Move-конструктор: перехватывает ресурсы из другого списка
-    slist(slist &&list)
+    // Забирает цепочку узлов другого списка (свой список должен быть пуст)
+    void steal(slist &list)
     {
         head = std::move(list.head); // передаём владение цепочкой узлов
+        tail = list.tail;
         length = list.length;
 
         // Оставляем исходный список пустым (но валидным)
         list.head = nullptr;
+        list.tail = nullptr;
         list.length = 0;
     }
 
-    // Деструктор не нужен: unique_ptr сам удалит все узлы
-    ~slist() = default;
-
-    // Вставка в конец: версия для lvalue (копирование)
-    void push_back(T &value)
+    // Присоединяет готовый узел в конец за O(1) через tail
+    void link_back(node_pointer newNode)
     {
-        // Создаём новый узел (владение у newNode - unique_ptr)
-        std::unique_ptr<Node<T>> newNode = std::make_unique<Node<T>>(value);
-
         if (head == nullptr)
         {
             // Список был пуст - head берёт владение
             head = std::move(newNode);
-            length++;
-            return;
+            tail = head.get();
         }
-
-        // Идём по списку с помощью сырых указателей (get())
-        // Не владеем узлами при обходе
-        Node<T> *cur = head.get();
-        while (cur->next != nullptr)
+        else
         {
+            // Передаём владение последнему узлу и сдвигаем tail
+            tail->next = std::move(newNode);
+            tail = tail->next.get();
+        }
+        length++;
+    }
+
+    // Узел с номером index (0 <= index < length): обход от head
+    node_type *node_at(std::size_t index) const
+    {
+        stats_walk(container_kind::slist, index);
+        node_type *cur = head.get();
+        for (std::size_t cnt = 0; cnt < index; ++cnt)
             cur = cur->next.get();
+        return cur;
+    }
+
+public:
+    // Пустой список
+    slist() : slist(Alloc()) {}
+
+    // Пустой список, узлы которого будут выделяться через allocator
+    explicit slist(const Alloc &allocator) : alloc(allocator)
+    {
+        head = nullptr;
+        tail = nullptr;
+        length = 0;
+    }
+
+    // Список из списка инициализации
+    slist(std::initializer_list<T> init, const Alloc &allocator = Alloc()) : slist(allocator)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    // Список из диапазона итераторов [first, last): узлы цепляются за один проход
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    slist(InputIt first, InputIt last, const Alloc &allocator = Alloc()) : slist(allocator)
+    {
+        append_range(first, last);
+    }
+
+    // Move-конструктор: перехватывает ресурсы (и аллокатор) из другого списка
+    slist(slist &&list) : alloc(std::move(list.alloc))
+    {
+        steal(list);
+    }
+
+    // Аллокатор, которым список выделяет узлы
+    Alloc get_allocator() const
+    {
+        return Alloc(alloc);
+    }
+
+    // Деструктор: узлы освобождаются в цикле (см. clear()), а не цепочкой
+    // рекурсивных деструкторов unique_ptr - иначе длинный список переполнит стек
+    ~slist()
+    {
+        clear();
+    }
+
+    // Удаляет все элементы.
+    // head по очереди забирает владение своим next, и старый узел уничтожается
+    // уже без хвоста - глубина вызовов не зависит от длины списка.
+    void clear()
+    {
+        while (head != nullptr)
+        {
+            // next забираем до уничтожения узла: unique_ptr сначала удаляет старый
+            // узел и лишь потом копирует удалитель из источника, а тот лежит в узле
+            node_pointer next = std::move(head->next);
+            head = std::move(next);
         }
+        tail = nullptr;
+        length = 0;
+    }
 
-        // Присоединяем новый узел: передаём владение через move
-        cur->next = std::move(newNode);
-        length++;
+    // Вставка в конец: версия для lvalue (копирование)
+    void push_back(T &value)
+    {
+        // Создаём новый узел (владение у newNode - unique_ptr) и цепляем его за tail
+        link_back(make_node(value));
     }
 
     // Вставка в конец: версия для rvalue (перемещение)
     void push_back(T &&value)
     {
-        std::unique_ptr<Node<T>> newNode = std::make_unique<Node<T>>(std::move(value));
+        link_back(make_node(std::move(value)));
+    }
+
+    // Вставка в конец: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        link_back(make_node(std::forward<Args>(args)...));
+        return tail->value;
+    }
+
+    // Вставка в начало: элемент конструируется прямо в узле из args
+    template <typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return emplace(0, std::forward<Args>(args)...);
+    }
+
+    // Вставка в начало: версия для lvalue (копирование)
+    void push_front(T &value)
+    {
+        insert(value, 0);
+    }
+
+    // Вставка в начало: версия для rvalue (перемещение)
+    void push_front(T &&value)
+    {
+        insert(std::move(value), 0);
+    }
+
+    // Удаление первого элемента
+    void pop_front()
+    {
         if (head == nullptr)
-        {
-            head = std::move(newNode);
-            length++;
-            return;
-        }
+            throw std::out_of_range("List is empty");
+        erase(0);
+    }
 
-        Node<T> *cur = head.get();
-        while (cur->next != nullptr)
-        {
-            cur = cur->next.get();
-        }
+    // Первый элемент за O(1). Пустой список проверяется только при LAB3_BOUNDS_CHECK
+    T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->value;
+    }
 
-        cur->next = std::move(newNode);
-        length++;
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->value;
+    }
+
+    // Последний элемент за O(1)
+    T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->value;
     }
 
     // Печать списка (для отладки)
-    void print()
+    void print() const
     {
-        Node<T> *cur = head.get(); // сырой указатель для обхода
-        while (cur != nullptr)
-        {
-            std::cout << cur->value << ' ';
-            cur = cur->next.get();
-        }
-        std::cout << '\n';
+        print_range(begin(), end());
+    }
+
+    // Вывод элементов через separator: текст копится в буфере и уходит в поток
+    // блоками по write_chunk_size байт, числа форматируются std::to_chars
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Потоковый режим: готовые блоки текста передаются в sink(const char *data, std::size_t size)
+    // по мере заполнения буфера - весь вывод целиком в памяти не собирается
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
     }
 
     // Возвращает длину списка
-    int size()
+    std::size_t size() const
     {
         return length;
     }
 
-    // Доступ по индексу (с проверкой границ)
-    T &operator[](int index)
+    // Пуст ли список
+    bool empty() const
     {
-        if (index < 0 || index >= length)
-            throw std::out_of_range("Index out of range");
+        return length == 0;
+    }
 
-        int cnt = 0;
-        Node<T> *cur = head.get();
-        while (cnt < index)
-        {
-            cur = cur->next.get();
-            cnt++;
-        }
-        return cur->value; // возвращаем ссылку - можно изменять
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
     }
 
-    // Вставка в произвольную позицию: перемещение
-    void insert(T &&value, int position)
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    T &at(std::size_t index)
     {
-        if (position > length || position < 0)
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return node_at(index)->value;
+    }
+
+    // Вставка в произвольную позицию: элемент конструируется прямо в узле из args.
+    // Возвращает ссылку на вставленный элемент.
+    template <typename... Args>
+    T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
             throw std::out_of_range("Index out of range");
 
-        std::unique_ptr<Node<T>> newNode = std::make_unique<Node<T>>(std::move(value));
+        node_pointer newNode = make_node(std::forward<Args>(args)...);
+        T &value = newNode->value;
+
+        if (position == length)
+        {
+            // Вставка в конец (в т.ч. в пустой список) - без обхода
+            link_back(std::move(newNode));
+            return value;
+        }
 
         if (position == 0)
         {
@@ -155,12 +404,13 @@ public:
             newNode->next = std::move(head);
             head = std::move(newNode);
             length++;
-            return;
+            return value;
         }
 
         // Ищем узел ДО позиции вставки
-        int cnt = 0;
-        Node<T> *cur = head.get();
+        stats_walk(container_kind::slist, position - 1);
+        std::size_t cnt = 0;
+        node_type *cur = head.get();
         while (cnt < position - 1)
         {
             cur = cur->next.get();
@@ -171,62 +421,57 @@ public:
         newNode->next = std::move(cur->next); // отрываем старый next
         cur->next = std::move(newNode);       // прикрепляем новый узел
         length++;
+        return value;
     }
 
-    // Вставка в произвольную позицию: копирование
-    void insert(T &value, int position)
+    // Вставка в произвольную позицию: перемещение
+    void insert(T &&value, std::size_t position)
     {
-        if (position > length || position < 0)
-            throw std::out_of_range("Index out of range");
-
-        std::unique_ptr<Node<T>> newNode = std::make_unique<Node<T>>(value);
-        if (position == 0)
-        {
-            newNode->next = std::move(head);
-            head = std::move(newNode);
-            length++;
-            return;
-        }
-
-        int cnt = 0;
-        Node<T> *cur = head.get();
-        while (cnt < position - 1)
-        {
-            cur = cur->next.get();
-            cnt++;
-        }
+        emplace(position, std::move(value));
+    }
 
-        newNode->next = std::move(cur->next);
-        cur->next = std::move(newNode);
-        length++;
+    // Вставка в произвольную позицию: копирование
+    void insert(T &value, std::size_t position)
+    {
+        emplace(position, value);
     }
 
     // Удаление по индексу
-    void erase(int position)
+    void erase(std::size_t position)
     {
-        if (position >= length || position < 0)
+        if (position >= length)
             throw std::out_of_range("Index out of range");
 
         if (position == 0)
         {
-            // Удаляем голову: передаём владение next новому head
-            head = std::move(head->next);
+            // Удаляем голову: передаём владение next новому head (через временный
+            // указатель - как в clear())
+            node_pointer next = std::move(head->next);
+            head = std::move(next);
+            if (head == nullptr)
+                tail = nullptr; // список стал пустым
             length--;
             return;
         }
 
         // Ищем узел перед удаляемым
-        int cnt = 0;
-        Node<T> *cur = head.get();
+        stats_walk(container_kind::slist, position - 1);
+        std::size_t cnt = 0;
+        node_type *cur = head.get();
         while (cnt < position - 1)
         {
             cur = cur->next.get();
             cnt++;
         }
 
+        // Удаляем последний узел - хвостом становится предыдущий
+        if (cur->next.get() == tail)
+            tail = cur;
+
         // "Перепрыгиваем" через удаляемый узел:
         // cur->next теперь владеет тем, чем владел cur->next->next
-        cur->next = std::move(cur->next->next);
+        node_pointer rest = std::move(cur->next->next);
+        cur->next = std::move(rest);
         length--;
     }
 
@@ -236,11 +481,24 @@ public:
         if (this == &list)
             return *this;
 
-        head = std::move(list.head);
-        length = list.length;
+        clear(); // старую цепочку освобождаем итеративно
 
-        list.head = nullptr;
-        list.length = 0;
+        if constexpr (node_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc = list.alloc; // аллокатор уходит вместе с узлами
+        }
+        else if (!(alloc == list.alloc))
+        {
+            // Узлы другого аллокатора забрать нельзя - перемещаем значения в свои узлы
+            for (node_type *cur = list.head.get(); cur != nullptr; cur = cur->next.get())
+            {
+                link_back(make_node(std::move(cur->value)));
+            }
+            list.clear();
+            return *this;
+        }
+
+        steal(list);
         return *this;
     }
 
@@ -251,14 +509,17 @@ public:
             return *this;
 
         // Очищаем текущий список
-        head.reset();
-        length = 0;
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value)
+        {
+            alloc = list.alloc;
+        }
 
-        // Копируем по одному элементу (используем push_back)
-        Node<T> *cur = list.head.get();
+        // Копируем по одному элементу, каждый новый узел цепляется за tail за O(1)
+        node_type *cur = list.head.get();
         while (cur != nullptr)
         {
-            push_back(cur->value); // вызовет копирующую версию push_back
+            link_back(make_node(cur->value));
             cur = cur->next.get();
         }
         return *this;
@@ -266,26 +527,357 @@ public:
 
     // Итератор: использует сырой указатель
     // не владеет узлами - только обходит их.
-    class Iterator
+    // Однонаправленный (forward): узел знает только следующий.
+    // IsConst = true - итератор только для чтения.
+    template <bool IsConst>
+    class BasicIterator
     {
-        Node<T> *ptr; // сырой указатель на текущий узел
+        using node = std::conditional_t<IsConst, const node_type, node_type>;
+
+        node *ptr;               // сырой указатель на текущий узел
+        const slist *beforeHead; // не nullptr только у before_begin(): позиция перед head этого списка
+
+        template <bool>
+        friend class BasicIterator;
+        friend class slist;
+
+        BasicIterator(node *p, const slist *list) : ptr(p), beforeHead(list) {}
 
     public:
-        Iterator(Node<T> *p) : ptr(p) {}
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T, T> *;
+        using reference = std::conditional_t<IsConst, const T, T> &;
+
+        BasicIterator() : ptr(nullptr), beforeHead(nullptr) {}
+        BasicIterator(node *p) : ptr(p), beforeHead(nullptr) {}
 
-        T &operator*() { return ptr->value; }
-        T &get() { return ptr->value; }
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst> &other) : ptr(other.ptr), beforeHead(other.beforeHead) {}
 
-        Iterator &operator++()
+        reference operator*() const { return ptr->value; }
+        pointer operator->() const { return &ptr->value; }
+        reference get() const { return ptr->value; }
+
+        BasicIterator &operator++()
         {
-            if (ptr != nullptr)
+            if (beforeHead != nullptr)
+            {
+                // С позиции before_begin() шаг вперёд - на первый узел
+                ptr = beforeHead->head.get();
+                beforeHead = nullptr;
+            }
+            else if (ptr != nullptr)
                 ptr = ptr->next.get(); // .get() - сырой указатель из unique_ptr
             return *this;
         }
 
-        bool operator!=(const Iterator &other) { return ptr != other.ptr; }
+        BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const BasicIterator &a, const BasicIterator &b)
+        {
+            return a.ptr == b.ptr && a.beforeHead == b.beforeHead;
+        }
+        friend bool operator!=(const BasicIterator &a, const BasicIterator &b) { return !(a == b); }
     };
 
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // Типы в стиле стандартной библиотеки
+    using value_type = T;
+    using allocator_type = Alloc;
+    using reference = T &;
+    using const_reference = const T &;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
     Iterator begin() { return Iterator(head.get()); }
     Iterator end() { return Iterator(nullptr); }
-};
\ No newline at end of file
+
+    ConstIterator begin() const { return ConstIterator(head.get()); }
+    ConstIterator end() const { return ConstIterator(nullptr); }
+    ConstIterator cbegin() const { return ConstIterator(head.get()); }
+    ConstIterator cend() const { return ConstIterator(nullptr); }
+
+    // Заменяет содержимое элементами [first, last).
+    // Новая цепочка строится целиком до того, как старая будет удалена.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last)
+    {
+        slist chain(first, last, get_allocator());
+        clear();
+        steal(chain);
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    // Добавление элементов [first, last) в конец
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            link_back(make_node(*first));
+        }
+    }
+
+    // Добавление в конец всех элементов диапазона (контейнера, initializer_list и т.п.)
+    template <typename Range>
+    void append_range(const Range &range)
+    {
+        using std::begin;
+        using std::end;
+        append_range(begin(range), end(range));
+    }
+
+    // Вставка элементов [first, last) перед позицией position.
+    // Узлы сначала собираются в отдельную цепочку, затем она вшивается в список
+    // целиком: до позиции - один проход, каждая вставка - O(1).
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert_range(std::size_t position, InputIt first, InputIt last)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+
+        slist chain(first, last, get_allocator());
+        if (chain.head == nullptr)
+            return;
+
+        // Позиция перед местом вставки
+        ConstIterator before = cbefore_begin();
+        if (position == length && tail != nullptr)
+            before = ConstIterator(tail);
+        else
+            for (std::size_t cnt = 0; cnt < position; ++cnt)
+                ++before;
+
+        node_pointer *owner = next_slot(before);
+        node_type *chainTail = chain.tail;
+        chainTail->next = std::move(*owner); // цепочка забирает хвост после позиции
+        *owner = std::move(chain.head);
+        if (chainTail->next == nullptr)
+            tail = chainTail; // вставили в конец
+        length += chain.length;
+
+        chain.tail = nullptr;
+        chain.length = 0;
+    }
+
+    // Позиция перед первым элементом: для insert_after/erase_after в начале списка
+    Iterator before_begin() { return Iterator(nullptr, this); }
+    ConstIterator before_begin() const { return ConstIterator(nullptr, this); }
+    ConstIterator cbefore_begin() const { return ConstIterator(nullptr, this); }
+
+    // Вставка после позиции pos за O(1): перемещение.
+    // Возвращает итератор на вставленный элемент.
+    Iterator insert_after(ConstIterator pos, T &&value)
+    {
+        return link_after(pos, make_node(std::move(value)));
+    }
+
+    // Вставка после позиции pos за O(1): копирование
+    Iterator insert_after(ConstIterator pos, T &value)
+    {
+        return link_after(pos, make_node(value));
+    }
+
+    // Вставка после позиции pos за O(1): элемент конструируется прямо в узле из args
+    template <typename... Args>
+    Iterator emplace_after(ConstIterator pos, Args &&...args)
+    {
+        return link_after(pos, make_node(std::forward<Args>(args)...));
+    }
+
+    // Удаление элемента, следующего за pos, за O(1).
+    // Возвращает итератор на элемент после удалённого.
+    Iterator erase_after(ConstIterator pos)
+    {
+        node_pointer *owner = next_slot(pos); // unique_ptr, которым владеет удаляемый узел
+        if (*owner == nullptr)
+            throw std::out_of_range("Iterator out of range");
+
+        node_type *before = pos.beforeHead != nullptr ? nullptr : const_cast<node_type *>(pos.ptr);
+        if (owner->get() == tail)
+            tail = before; // удаляем последний - хвостом становится pos
+
+        // owner теперь владеет тем, чем владел удаляемый узел
+        node_pointer rest = std::move((*owner)->next);
+        *owner = std::move(rest);
+        length--;
+        return Iterator(owner->get());
+    }
+
+    // Алгоритмы на перешивании узлов (list_algorithms.h): значения не копируются
+    // и не перемещаются, память не выделяется, итераторы остаются действительными
+
+    // Устойчивая сортировка слиянием, O(N log N). Если comp бросит исключение,
+    // все элементы остаются в списке, но порядок не определён
+    template <typename Compare>
+    void sort(Compare comp)
+    {
+        try
+        {
+            sort_chain(head, comp);
+        }
+        catch (...)
+        {
+            tail = chain_last(head);
+            throw;
+        }
+        tail = chain_last(head);
+    }
+
+    void sort()
+    {
+        sort(std::less<>());
+    }
+
+    // Сливает отсортированный other в этот (отсортированный) список за O(N + M);
+    // other становится пустым. При равных элементах свои идут раньше
+    template <typename Compare>
+    void merge(slist &other, Compare comp)
+    {
+        if (&other == this)
+            return;
+        node_pointer merged;
+        try
+        {
+            merge_chains(head, other.head, merged, comp);
+        }
+        catch (...)
+        {
+            // Остатки обеих цепочек - за уже слитой частью
+            *chain_end(merged) = std::move(head);
+            *chain_end(merged) = std::move(other.head);
+            head = std::move(merged);
+            tail = chain_last(head);
+            length += other.length;
+            other.tail = nullptr;
+            other.length = 0;
+            throw;
+        }
+        head = std::move(merged);
+        tail = chain_last(head);
+        length += other.length;
+        other.tail = nullptr;
+        other.length = 0;
+    }
+
+    void merge(slist &other)
+    {
+        merge(other, std::less<>());
+    }
+
+    void merge(slist &&other)
+    {
+        merge(other, std::less<>());
+    }
+
+    // Обратный порядок элементов за O(N)
+    void reverse()
+    {
+        node_type *first = head.get();
+        reverse_chain(head);
+        tail = first;
+    }
+
+    // Удаляет элементы, для которых pred(value) истинно; возвращает их количество
+    template <typename Pred>
+    std::size_t remove_if(Pred pred)
+    {
+        return drop_nodes([this, &pred](node_pointer &removed, std::size_t &count)
+                          { extract_chain_if(head, pred, removed, count); });
+    }
+
+    // Удаляет элементы, равные value (value может быть элементом этого же списка)
+    std::size_t remove(const T &value)
+    {
+        return remove_if([&value](const T &item) { return item == value; });
+    }
+
+    // Удаляет подряд идущие повторы, оставляя первый из них (same(a, b) - "равны")
+    template <typename BinaryPred>
+    std::size_t unique(BinaryPred same)
+    {
+        return drop_nodes([this, &same](node_pointer &removed, std::size_t &count)
+                          { extract_chain_duplicates(head, same, removed, count); });
+    }
+
+    std::size_t unique()
+    {
+        return unique(std::equal_to<>());
+    }
+
+private:
+    // Выполняет extract(removed, count), затем уничтожает вынутые узлы и
+    // восстанавливает length и tail (в том числе при исключении из предиката)
+    template <typename Extract>
+    std::size_t drop_nodes(Extract extract)
+    {
+        node_pointer removed;
+        std::size_t count = 0;
+        try
+        {
+            extract(removed, count);
+        }
+        catch (...)
+        {
+            length -= count;
+            tail = chain_last(head);
+            clear_chain(removed);
+            throw;
+        }
+        length -= count;
+        tail = chain_last(head);
+        clear_chain(removed);
+        return count;
+    }
+
+    // unique_ptr, в котором лежит узел, следующий за pos: head для before_begin(),
+    // иначе pos->next. Для end() и before_begin() другого списка бросает out_of_range.
+    node_pointer *next_slot(ConstIterator pos)
+    {
+        if (pos.beforeHead != nullptr)
+        {
+            if (pos.beforeHead != this)
+                throw std::out_of_range("Iterator out of range");
+            return &head;
+        }
+        if (pos.ptr == nullptr)
+            throw std::out_of_range("Iterator out of range");
+        return &const_cast<node_type *>(pos.ptr)->next;
+    }
+
+    // Цепляет готовый узел сразу после pos
+    Iterator link_after(ConstIterator pos, node_pointer newNode)
+    {
+        node_pointer *owner = next_slot(pos);
+        node_type *raw = newNode.get();
+
+        newNode->next = std::move(*owner); // новый узел забирает хвост после pos
+        *owner = std::move(newNode);
+        if (raw->next == nullptr)
+            tail = raw; // вставили в конец
+        length++;
+        return Iterator(raw);
+    }
+};
+
+// Список с узлами из std::pmr::memory_resource (см. pmr::myvector)
+namespace pmr
+{
+    template <typename T>
+    using slist = ::slist<T, std::pmr::polymorphic_allocator<T>>;
+}
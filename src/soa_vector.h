@@ -0,0 +1,436 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "bounds_check.h"
+#include "myvector.h"
+
+// Непрерывный участок одного столбца soa_vector (аналог std::span из C++20).
+// Указатель в массив столбца действителен до следующего перевыделения вектора.
+template <typename T>
+class soa_span
+{
+private:
+    T *items = nullptr;
+    std::size_t length = 0;
+
+public:
+    soa_span() = default;
+    soa_span(T *first, std::size_t count) : items(first), length(count) {}
+
+    std::size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    T *data() const { return items; }
+    T *begin() const { return items; }
+    T *end() const { return items + length; }
+
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return items[index];
+    }
+};
+
+// Вектор записей, хранящий каждое поле в своём непрерывном массиве
+// (structure of arrays): soa_vector<int, double, char> - это три массива
+// int[], double[] и char[] одной длины. Проход по одному полю читает только
+// его байты, а не записи целиком, и компилятор может векторизовать такой цикл.
+//
+// Все столбцы лежат в одном блоке памяти, каждый начинается с границы 64 байт
+// (кэш-линия, ширина AVX-512). Ёмкость растёт по той же политике Growth, что у
+// myvector; при перевыделении элементы всех столбцов переносятся вместе,
+// итераторы и span'ы становятся недействительными.
+template <typename Growth, typename... Fields>
+class basic_soa_vector
+{
+    static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+public:
+    // Выравнивание начала каждого столбца
+    static constexpr std::size_t column_alignment = 64;
+
+    using row_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields &...>;
+    using const_reference = std::tuple<const Fields &...>;
+
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, row_type>;
+
+private:
+    static constexpr std::size_t fieldCount = sizeof...(Fields);
+    using indices = std::index_sequence_for<Fields...>;
+
+    void *block = nullptr;           // общий блок памяти всех столбцов
+    std::tuple<Fields *...> columns; // начало массива каждого столбца
+    std::size_t reserved = 0;        // ёмкость (в записях)
+    std::size_t length = 0;          // количество записей
+
+    // Смещение начала столбца I в блоке на capacity записей
+    template <std::size_t I>
+    static std::size_t column_offset(std::size_t capacity)
+    {
+        if constexpr (I == 0)
+        {
+            return 0;
+        }
+        else
+        {
+            std::size_t end = column_offset<I - 1>(capacity) + sizeof(field_type<I - 1>) * capacity;
+            return (end + column_alignment - 1) / column_alignment * column_alignment;
+        }
+    }
+
+    // Размер блока на capacity записей
+    static std::size_t block_bytes(std::size_t capacity)
+    {
+        return column_offset<fieldCount - 1>(capacity) + sizeof(field_type<fieldCount - 1>) * capacity;
+    }
+
+    // Указатели на столбцы в блоке raw
+    template <std::size_t... I>
+    static std::tuple<Fields *...> carve(void *raw, std::size_t capacity, std::index_sequence<I...>)
+    {
+        unsigned char *base = static_cast<unsigned char *>(raw);
+        return std::tuple<Fields *...>(reinterpret_cast<Fields *>(base + column_offset<I>(capacity))...);
+    }
+
+    // Уничтожает поля [first, last) в каждом столбце
+    template <std::size_t... I>
+    static void destroy_rows(std::tuple<Fields *...> &cols, std::size_t first, std::size_t last,
+                             std::index_sequence<I...>)
+    {
+        (std::destroy(std::get<I>(cols) + first, std::get<I>(cols) + last), ...);
+    }
+
+    // Перемещать ли столбцы при переносе в новый блок. Решение общее для всех
+    // столбцов: если бы строковый столбец 0 переместился, а копия столбца 1
+    // бросила исключение, в старом блоке остались бы пустые строки. Поэтому
+    // перемещение - только когда ни один столбец не может бросить при нём
+    // исключение (или столбец не копируется вовсе), иначе копируются все
+    // копируемые столбцы - и при исключении старый блок цел (как move_if_noexcept)
+    static constexpr bool move_columns =
+        ((std::is_nothrow_move_constructible<Fields>::value || !std::is_copy_constructible<Fields>::value) && ...);
+
+    // Переносит length записей в to столбец за столбцом; если перенос
+    // столбца I бросит исключение, уже перенесённые столбцы в to уничтожаются
+    template <std::size_t I = 0>
+    void transfer_columns(std::tuple<Fields *...> &to)
+    {
+        if constexpr (I < fieldCount)
+        {
+            using F = field_type<I>;
+            F *source = std::get<I>(columns);
+            F *dest = std::get<I>(to);
+            if constexpr (move_columns || !std::is_copy_constructible<F>::value)
+                std::uninitialized_move(source, source + length, dest);
+            else
+                std::uninitialized_copy(source, source + length, dest);
+
+            try
+            {
+                transfer_columns<I + 1>(to);
+            }
+            catch (...)
+            {
+                std::destroy(dest, dest + length);
+                throw;
+            }
+        }
+    }
+
+    // Переносит записи в новый блок ёмкостью newCapacity (не меньше length)
+    void relocate(std::size_t newCapacity)
+    {
+        void *raw = ::operator new(block_bytes(newCapacity), std::align_val_t(column_alignment));
+        std::tuple<Fields *...> fresh = carve(raw, newCapacity, indices());
+        try
+        {
+            transfer_columns(fresh);
+        }
+        catch (...)
+        {
+            ::operator delete(raw, std::align_val_t(column_alignment));
+            throw;
+        }
+
+        destroy_rows(columns, 0, length, indices());
+        ::operator delete(block, std::align_val_t(column_alignment));
+        block = raw;
+        columns = fresh;
+        reserved = newCapacity;
+    }
+
+    // Ёмкость не меньше required (новую выбирает Growth)
+    void grow(std::size_t required)
+    {
+        if (required > max_size())
+            throw std::length_error("soa_vector is too long");
+        relocate(std::min(Growth::next(reserved, required, block_bytes(1)), max_size()));
+    }
+
+    // Конструирует поля I... записи index из args; при исключении уже
+    // построенные поля этой записи уничтожаются
+    template <std::size_t I = 0, typename Tuple>
+    void construct_row(std::size_t index, Tuple &&args)
+    {
+        if constexpr (I < fieldCount)
+        {
+            using F = field_type<I>;
+            F *cell = std::get<I>(columns) + index;
+            ::new (static_cast<void *>(cell)) F(std::get<I>(std::forward<Tuple>(args)));
+            try
+            {
+                construct_row<I + 1>(index, std::forward<Tuple>(args));
+            }
+            catch (...)
+            {
+                cell->~F();
+                throw;
+            }
+        }
+    }
+
+    template <std::size_t... I>
+    reference row(std::size_t index, std::index_sequence<I...>)
+    {
+        return reference(std::get<I>(columns)[index]...);
+    }
+
+    template <std::size_t... I>
+    const_reference row(std::size_t index, std::index_sequence<I...>) const
+    {
+        return const_reference(std::get<I>(columns)[index]...);
+    }
+
+public:
+    basic_soa_vector() = default;
+
+    // Перемещение передаёт блок целиком
+    basic_soa_vector(basic_soa_vector &&other)
+        : block(std::exchange(other.block, nullptr)), columns(other.columns),
+          reserved(std::exchange(other.reserved, 0)), length(std::exchange(other.length, 0))
+    {
+    }
+
+    basic_soa_vector &operator=(basic_soa_vector &&other)
+    {
+        if (this != &other)
+        {
+            clear();
+            ::operator delete(block, std::align_val_t(column_alignment));
+            block = std::exchange(other.block, nullptr);
+            columns = other.columns;
+            reserved = std::exchange(other.reserved, 0);
+            length = std::exchange(other.length, 0);
+        }
+        return *this;
+    }
+
+    basic_soa_vector(const basic_soa_vector &) = delete;
+    basic_soa_vector &operator=(const basic_soa_vector &) = delete;
+
+    ~basic_soa_vector()
+    {
+        clear();
+        ::operator delete(block, std::align_val_t(column_alignment));
+    }
+
+    std::size_t size() const { return length; }
+    std::size_t capacity() const { return reserved; }
+    bool empty() const { return length == 0; }
+
+    // Наибольшее количество записей
+    static constexpr std::size_t max_size()
+    {
+        return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) /
+               (0 + ... + (sizeof(Fields) + column_alignment));
+    }
+
+    // Гарантирует ёмкость не меньше count
+    void reserve(std::size_t count)
+    {
+        if (count > max_size())
+            throw std::length_error("soa_vector is too long");
+        if (count > reserved)
+            relocate(count);
+    }
+
+    // Удаляет все записи (память остаётся)
+    void clear()
+    {
+        destroy_rows(columns, 0, length, indices());
+        length = 0;
+    }
+
+    // Добавление записи: каждое поле конструируется из своего аргумента
+    template <typename... Args>
+    void emplace_back(Args &&...args)
+    {
+        static_assert(sizeof...(Args) == fieldCount, "emplace_back needs one argument per field");
+        if (length == reserved)
+        {
+            // Аргументы могут ссылаться на поля этого же вектора - строим запись до перевыделения
+            row_type tmp(std::forward<Args>(args)...);
+            grow(length + 1);
+            construct_row(length, std::move(tmp));
+        }
+        else
+        {
+            construct_row(length, std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+        length++;
+    }
+
+    // Добавление записи из кортежа
+    void push_back(const row_type &record)
+    {
+        std::apply([this](const Fields &...fields) { emplace_back(fields...); }, record);
+    }
+
+    void push_back(row_type &&record)
+    {
+        std::apply([this](Fields &...fields) { emplace_back(std::move(fields)...); }, record);
+    }
+
+    // Удаление последней записи
+    void pop_back()
+    {
+        if (length == 0)
+            throw std::out_of_range("Vector is empty");
+        destroy_rows(columns, length - 1, length, indices());
+        length--;
+    }
+
+    // Запись по индексу - кортеж ссылок на её поля.
+    // Границы проверяются только при LAB3_BOUNDS_CHECK
+    reference operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return row(index, indices());
+    }
+
+    const_reference operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return row(index, indices());
+    }
+
+    // Запись по индексу с проверкой границ в любой сборке
+    reference at(std::size_t index)
+    {
+        check_index(index, length);
+        return row(index, indices());
+    }
+
+    const_reference at(std::size_t index) const
+    {
+        check_index(index, length);
+        return row(index, indices());
+    }
+
+    // Поле I записи index
+    template <std::size_t I>
+    field_type<I> &get(std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return std::get<I>(columns)[index];
+    }
+
+    template <std::size_t I>
+    const field_type<I> &get(std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return std::get<I>(columns)[index];
+    }
+
+    // Столбец I целиком: непрерывный выровненный массив из size() элементов
+    template <std::size_t I>
+    soa_span<field_type<I>> column()
+    {
+        return soa_span<field_type<I>>(std::get<I>(columns), length);
+    }
+
+    template <std::size_t I>
+    soa_span<const field_type<I>> column() const
+    {
+        return soa_span<const field_type<I>>(std::get<I>(columns), length);
+    }
+
+    // Итератор по записям ("зип" столбцов): разыменование даёт кортеж ссылок,
+    // поэтому работает for (auto [id, price] : table)
+    template <bool IsConst>
+    class BasicIterator
+    {
+    public:
+        using owner_type = std::conditional_t<IsConst, const basic_soa_vector, basic_soa_vector>;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = row_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const_reference, typename basic_soa_vector::reference>;
+        using pointer = void;
+
+    private:
+        owner_type *owner = nullptr;
+        std::size_t index = 0;
+
+    public:
+        BasicIterator() = default;
+        BasicIterator(owner_type *vect, std::size_t position) : owner(vect), index(position) {}
+
+        // Неконстантный итератор превращается в константный
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        BasicIterator(const BasicIterator<WasConst> &other) : owner(other.owner), index(other.index)
+        {
+        }
+
+        reference operator*() const { return owner->row(index, indices()); }
+
+        BasicIterator &operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++index;
+            return old;
+        }
+
+        bool operator==(const BasicIterator &other) const { return index == other.index; }
+        bool operator!=(const BasicIterator &other) const { return index != other.index; }
+
+        template <bool>
+        friend class BasicIterator;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, length); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, length); }
+    ConstIterator cbegin() const { return ConstIterator(this, 0); }
+    ConstIterator cend() const { return ConstIterator(this, length); }
+};
+
+// soa_vector с политикой роста myvector по умолчанию
+template <typename... Fields>
+using soa_vector = basic_soa_vector<growth_2x, Fields...>;
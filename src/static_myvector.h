@@ -0,0 +1,322 @@
+#pragma once
+#include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "bounds_check.h"
+#include "write_buffer.h"
+
+// Вектор фиксированной ёмкости N с массивом прямо в объекте: в куче ничего
+// не выделяется, данные лежат там же, где сам вектор (на стеке, в другом
+// объекте, в статической памяти).
+//
+// Все операции, кроме вывода, - constexpr: для литерального T (int, double,
+// агрегаты из них) вектор можно заполнить при компиляции и положить таблицу
+// в constexpr-переменную:
+//     constexpr auto squares = [] {
+//         static_myvector<int, 16> table;
+//         for (int i = 0; i < 16; ++i)
+//             table.push_back(i * i);
+//         return table;
+//     }();
+//
+// В C++17 в constexpr нельзя строить объект в сырой памяти, поэтому массив
+// из N элементов построен всегда: T должен иметь конструктор по умолчанию,
+// ячейки за size() хранят T(), а удаление присваивает ячейке T() (у строки
+// освобождается память). Переполнение - std::length_error.
+template <typename T, std::size_t N>
+class static_myvector
+{
+    static_assert(std::is_default_constructible<T>::value, "static_myvector needs a default-constructible T");
+
+private:
+    T items[N == 0 ? 1 : N]{};
+    std::size_t length = 0;
+
+    constexpr void check_room() const
+    {
+        if (length == N)
+            throw std::length_error("static_myvector is full");
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<T *>;
+    using const_reverse_iterator = std::reverse_iterator<const T *>;
+
+    // Результат index_of(), если элемента нет
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    constexpr static_myvector() = default;
+
+    constexpr static_myvector(std::initializer_list<T> init)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    constexpr static_myvector(InputIt first, InputIt last)
+    {
+        append_range(first, last);
+    }
+
+    constexpr std::size_t size() const
+    {
+        return length;
+    }
+
+    static constexpr std::size_t capacity()
+    {
+        return N;
+    }
+
+    static constexpr std::size_t max_size()
+    {
+        return N;
+    }
+
+    constexpr bool empty() const
+    {
+        return length == 0;
+    }
+
+    constexpr bool full() const
+    {
+        return length == N;
+    }
+
+    // Добавление в конец: копирующая версия (для lvalue)
+    constexpr void push_back(T &value)
+    {
+        check_room();
+        items[length++] = value;
+    }
+
+    // Добавление в конец: перемещающая версия (для rvalue)
+    constexpr void push_back(T &&value)
+    {
+        check_room();
+        items[length++] = std::move(value);
+    }
+
+    // Добавление в конец значения из args. Возвращает ссылку на добавленный элемент
+    template <typename... Args>
+    constexpr T &emplace_back(Args &&...args)
+    {
+        check_room();
+        items[length] = T(std::forward<Args>(args)...);
+        return items[length++];
+    }
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    constexpr void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    // Удаление последнего элемента
+    constexpr void pop_back()
+    {
+        if (length == 0)
+            throw std::out_of_range("Vector is empty");
+        items[--length] = T();
+    }
+
+    // Вставка в произвольную позицию: хвост сдвигается вправо на одну ячейку
+    template <typename... Args>
+    constexpr T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+        check_room();
+
+        T value(std::forward<Args>(args)...); // args могут ссылаться на сдвигаемый элемент
+        for (std::size_t i = length; i > position; --i)
+            items[i] = std::move(items[i - 1]);
+        items[position] = std::move(value);
+        length++;
+        return items[position];
+    }
+
+    // Вставка в произвольную позицию: перемещающая версия
+    constexpr void insert(T &&value, std::size_t position)
+    {
+        emplace(position, std::move(value));
+    }
+
+    // Вставка в произвольную позицию: копирующая версия
+    constexpr void insert(T &value, std::size_t position)
+    {
+        emplace(position, value);
+    }
+
+    // Удаление элемента по индексу: хвост сдвигается влево
+    constexpr void erase(std::size_t position)
+    {
+        if (position >= length)
+            throw std::out_of_range("Index out of range");
+        for (std::size_t i = position + 1; i < length; ++i)
+            items[i - 1] = std::move(items[i]);
+        items[--length] = T();
+    }
+
+    // Новый размер count: недостающие элементы - T(), лишние удаляются
+    constexpr void resize(std::size_t count)
+    {
+        if (count > N)
+            throw std::length_error("static_myvector is full");
+        while (length > count)
+            items[--length] = T();
+        length = count;
+    }
+
+    // Удаляет все элементы
+    constexpr void clear()
+    {
+        resize(0);
+    }
+
+    // Доступ по индексу. Границы проверяются только при LAB3_BOUNDS_CHECK
+    constexpr T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return items[index];
+    }
+
+    constexpr const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return items[index];
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    constexpr T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return items[index];
+    }
+
+    constexpr const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return items[index];
+    }
+
+    // Первый и последний элементы. Пустой вектор проверяется только при LAB3_BOUNDS_CHECK
+    constexpr T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return items[0];
+    }
+
+    constexpr const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return items[0];
+    }
+
+    constexpr T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return items[length - 1];
+    }
+
+    constexpr const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "Vector is empty");
+        return items[length - 1];
+    }
+
+    constexpr T *data() { return items; }
+    constexpr const T *data() const { return items; }
+
+    constexpr T *begin() { return items; }
+    constexpr T *end() { return items + length; }
+    constexpr const T *begin() const { return items; }
+    constexpr const T *end() const { return items + length; }
+    constexpr const T *cbegin() const { return items; }
+    constexpr const T *cend() const { return items + length; }
+    constexpr reverse_iterator rbegin() { return reverse_iterator(end()); }
+    constexpr reverse_iterator rend() { return reverse_iterator(begin()); }
+    constexpr const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    constexpr const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    // Индекс первого элемента, равного value, или npos
+    constexpr std::size_t index_of(const T &value) const
+    {
+        for (std::size_t i = 0; i < length; ++i)
+            if (items[i] == value)
+                return i;
+        return npos;
+    }
+
+    constexpr bool contains(const T &value) const
+    {
+        return index_of(value) != npos;
+    }
+
+    constexpr std::size_t count(const T &value) const
+    {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < length; ++i)
+            if (items[i] == value)
+                found++;
+        return found;
+    }
+
+    friend constexpr bool operator==(const static_myvector &a, const static_myvector &b)
+    {
+        if (a.length != b.length)
+            return false;
+        for (std::size_t i = 0; i < a.length; ++i)
+            if (!(a.items[i] == b.items[i]))
+                return false;
+        return true;
+    }
+
+    friend constexpr bool operator!=(const static_myvector &a, const static_myvector &b)
+    {
+        return !(a == b);
+    }
+
+    // Печать всех элементов (для отладки)
+    void print() const
+    {
+        print_range(begin(), end());
+    }
+
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
+    }
+};
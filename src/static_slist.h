@@ -0,0 +1,492 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "bounds_check.h"
+#include "write_buffer.h"
+
+// Самый узкий беззнаковый тип для номеров узлов 0..N-1 и метки "нет узла"
+template <std::size_t N>
+using static_index_t = std::conditional_t<
+    (N < 0xFF), std::uint8_t,
+    std::conditional_t<(N < 0xFFFF), std::uint16_t, std::conditional_t<(N < 0xFFFFFFFFu), std::uint32_t, std::size_t>>>;
+
+// Узел static_slist: значение и номер следующего узла в массиве списка
+template <typename T, typename Index>
+struct StaticNode
+{
+    T value{};
+    Index next = std::numeric_limits<Index>::max();
+};
+
+// Односвязный список фиксированной ёмкости N: узлы лежат в массиве внутри
+// объекта и связаны номерами, а не указателями. В куче ничего не выделяется;
+// номер узла - 1, 2 или 4 байта (по N), поэтому узел int при N < 255 занимает
+// 8 байт вместо 16 у slist, и весь список лежит в нескольких кэш-линиях.
+//
+// Освобождённые узлы уходят в список свободных и берутся из него первыми,
+// затем - ещё не использованные ячейки массива по порядку. Переполнение -
+// std::length_error.
+//
+// Как и static_myvector, список целиком constexpr (кроме вывода): для
+// литерального T его можно собрать при компиляции. По той же причине T нужен
+// конструктор по умолчанию, а освобождаемому узлу присваивается T().
+//
+// Копия списка копирует массив целиком, итераторы (список + номер узла) и
+// ссылки на элементы остаются действительными до удаления своего элемента.
+template <typename T, std::size_t N>
+class static_slist
+{
+    static_assert(std::is_default_constructible<T>::value, "static_slist needs a default-constructible T");
+
+private:
+    using index_type = static_index_t<N>;
+    using node_type = StaticNode<T, index_type>;
+
+    static constexpr index_type none = std::numeric_limits<index_type>::max(); // "нет узла"
+
+    node_type nodes[N == 0 ? 1 : N]{};
+    index_type head = none;
+    index_type tail = none;
+    index_type freeHead = none; // первый освобождённый узел
+    std::size_t used = 0;       // ячеек, которые хоть раз были узлами
+    std::size_t length = 0;
+
+    // Свободный узел со значением value (next = none)
+    constexpr index_type take_node(T &&value)
+    {
+        index_type node = none;
+        if (freeHead != none)
+        {
+            node = freeHead;
+            freeHead = nodes[node].next;
+        }
+        else if (used < N)
+        {
+            node = static_cast<index_type>(used++);
+        }
+        else
+        {
+            throw std::length_error("static_slist is full");
+        }
+        nodes[node].value = std::move(value);
+        nodes[node].next = none;
+        return node;
+    }
+
+    // Возвращает узел в список свободных
+    constexpr void release_node(index_type node)
+    {
+        nodes[node].value = T();
+        nodes[node].next = freeHead;
+        freeHead = node;
+    }
+
+    constexpr index_type node_at(std::size_t index) const
+    {
+        index_type node = head;
+        for (std::size_t i = 0; i < index; ++i)
+            node = nodes[node].next;
+        return node;
+    }
+
+    // Вставка готового узла после prev (none - в начало)
+    constexpr T &link_after(index_type prev, index_type node)
+    {
+        if (prev == none)
+        {
+            nodes[node].next = head;
+            head = node;
+        }
+        else
+        {
+            nodes[node].next = nodes[prev].next;
+            nodes[prev].next = node;
+        }
+        if (nodes[node].next == none)
+            tail = node;
+        length++;
+        return nodes[node].value;
+    }
+
+    // Удаление узла после prev (none - первого)
+    constexpr void unlink_after(index_type prev)
+    {
+        index_type node = prev == none ? head : nodes[prev].next;
+        if (node == none)
+            return; // вызывающий уже проверил длину; так компилятор видит, что nodes[none] не читается
+        if (prev == none)
+            head = nodes[node].next;
+        else
+            nodes[prev].next = nodes[node].next;
+        if (node == tail)
+            tail = prev;
+        release_node(node);
+        length--;
+    }
+
+public:
+    // Итератор вперёд: список и номер узла
+    template <bool IsConst>
+    class BasicIterator
+    {
+        using owner = std::conditional_t<IsConst, const static_slist, static_slist>;
+        using element = std::conditional_t<IsConst, const T, T>;
+
+        owner *list;
+        index_type node;
+
+        template <bool>
+        friend class BasicIterator;
+        friend class static_slist;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = element *;
+        using reference = element &;
+
+        constexpr BasicIterator() : list(nullptr), node(none) {}
+        constexpr BasicIterator(owner *l, index_type n) : list(l), node(n) {}
+
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        constexpr BasicIterator(const BasicIterator<OtherConst> &other) : list(other.list), node(other.node) {}
+
+        constexpr reference operator*() const { return list->nodes[node].value; }
+        constexpr pointer operator->() const { return &list->nodes[node].value; }
+        constexpr reference get() const { return **this; }
+
+        constexpr BasicIterator &operator++()
+        {
+            node = list->nodes[node].next;
+            return *this;
+        }
+
+        constexpr BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend constexpr bool operator==(const BasicIterator &a, const BasicIterator &b) { return a.node == b.node; }
+        friend constexpr bool operator!=(const BasicIterator &a, const BasicIterator &b) { return a.node != b.node; }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    constexpr static_slist() = default;
+
+    constexpr static_slist(std::initializer_list<T> init)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    constexpr static_slist(InputIt first, InputIt last)
+    {
+        append_range(first, last);
+    }
+
+    constexpr std::size_t size() const
+    {
+        return length;
+    }
+
+    static constexpr std::size_t capacity()
+    {
+        return N;
+    }
+
+    static constexpr std::size_t max_size()
+    {
+        return N;
+    }
+
+    constexpr bool empty() const
+    {
+        return length == 0;
+    }
+
+    constexpr bool full() const
+    {
+        return length == N;
+    }
+
+    // Удаляет все элементы
+    constexpr void clear()
+    {
+        while (head != none)
+            unlink_after(none);
+    }
+
+    // Добавление в конец за O(1)
+    constexpr void push_back(T &value)
+    {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(T &&value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    constexpr T &emplace_back(Args &&...args)
+    {
+        return link_after(tail, take_node(T(std::forward<Args>(args)...)));
+    }
+
+    // Добавление в начало за O(1)
+    constexpr void push_front(T &value)
+    {
+        emplace_front(value);
+    }
+
+    constexpr void push_front(T &&value)
+    {
+        emplace_front(std::move(value));
+    }
+
+    template <typename... Args>
+    constexpr T &emplace_front(Args &&...args)
+    {
+        return link_after(none, take_node(T(std::forward<Args>(args)...)));
+    }
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    constexpr void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    // Удаление первого элемента
+    constexpr void pop_front()
+    {
+        if (head == none)
+            throw std::out_of_range("List is empty");
+        unlink_after(none);
+    }
+
+    // Первый и последний элементы за O(1). Пустой список проверяется только при LAB3_BOUNDS_CHECK
+    constexpr T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return nodes[head].value;
+    }
+
+    constexpr const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return nodes[head].value;
+    }
+
+    constexpr T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return nodes[tail].value;
+    }
+
+    constexpr const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return nodes[tail].value;
+    }
+
+    // Доступ по индексу за O(index). Границы проверяются только при LAB3_BOUNDS_CHECK
+    constexpr T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return nodes[node_at(index)].value;
+    }
+
+    constexpr const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return nodes[node_at(index)].value;
+    }
+
+    constexpr T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return nodes[node_at(index)].value;
+    }
+
+    constexpr const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return nodes[node_at(index)].value;
+    }
+
+    // Вставка в произвольную позицию: элемент строится из args
+    template <typename... Args>
+    constexpr T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+        index_type prev = position == 0 ? none : position == length ? tail : node_at(position - 1);
+        return link_after(prev, take_node(T(std::forward<Args>(args)...)));
+    }
+
+    constexpr void insert(T &&value, std::size_t position)
+    {
+        emplace(position, std::move(value));
+    }
+
+    constexpr void insert(T &value, std::size_t position)
+    {
+        emplace(position, value);
+    }
+
+    // Удаление по индексу
+    constexpr void erase(std::size_t position)
+    {
+        if (position >= length)
+            throw std::out_of_range("Index out of range");
+        unlink_after(position == 0 ? none : node_at(position - 1));
+    }
+
+    // Вставка после pos за O(1); возвращает итератор на новый элемент
+    constexpr Iterator insert_after(ConstIterator pos, T &&value)
+    {
+        return emplace_after(pos, std::move(value));
+    }
+
+    constexpr Iterator insert_after(ConstIterator pos, T &value)
+    {
+        return emplace_after(pos, value);
+    }
+
+    template <typename... Args>
+    constexpr Iterator emplace_after(ConstIterator pos, Args &&...args)
+    {
+        index_type node = take_node(T(std::forward<Args>(args)...));
+        link_after(pos.node, node);
+        return Iterator(this, node);
+    }
+
+    // Удаление элемента после pos за O(1); возвращает итератор на следующий за удалённым
+    constexpr Iterator erase_after(ConstIterator pos)
+    {
+        if (pos.node == none || nodes[pos.node].next == none)
+            throw std::out_of_range("Index out of range");
+        unlink_after(pos.node);
+        return Iterator(this, nodes[pos.node].next);
+    }
+
+    // Разворот перешиванием номеров, без переноса значений
+    constexpr void reverse()
+    {
+        index_type done = none;
+        tail = head;
+        while (head != none)
+        {
+            index_type next = nodes[head].next;
+            nodes[head].next = done;
+            done = head;
+            head = next;
+        }
+        head = done;
+    }
+
+    // Удаляет элементы, для которых pred(value) истинно; возвращает их число
+    template <typename Pred>
+    constexpr std::size_t remove_if(Pred pred)
+    {
+        std::size_t removed = 0;
+        index_type prev = none;
+        index_type node = head;
+        while (node != none)
+        {
+            index_type next = nodes[node].next;
+            if (pred(static_cast<const T &>(nodes[node].value)))
+            {
+                unlink_after(prev);
+                removed++;
+            }
+            else
+            {
+                prev = node;
+            }
+            node = next;
+        }
+        return removed;
+    }
+
+    constexpr std::size_t remove(const T &value)
+    {
+        T copy(value); // value может лежать в удаляемом узле
+        return remove_if([&copy](const T &item) { return item == copy; });
+    }
+
+    constexpr Iterator begin() { return Iterator(this, head); }
+    constexpr Iterator end() { return Iterator(this, none); }
+    constexpr ConstIterator begin() const { return ConstIterator(this, head); }
+    constexpr ConstIterator end() const { return ConstIterator(this, none); }
+    constexpr ConstIterator cbegin() const { return begin(); }
+    constexpr ConstIterator cend() const { return end(); }
+
+    friend constexpr bool operator==(const static_slist &a, const static_slist &b)
+    {
+        if (a.length != b.length)
+            return false;
+        for (index_type x = a.head, y = b.head; x != none; x = a.nodes[x].next, y = b.nodes[y].next)
+            if (!(a.nodes[x].value == b.nodes[y].value))
+                return false;
+        return true;
+    }
+
+    friend constexpr bool operator!=(const static_slist &a, const static_slist &b)
+    {
+        return !(a == b);
+    }
+
+    // Печать всех элементов (для отладки)
+    void print() const
+    {
+        print_range(begin(), end());
+    }
+
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
+    }
+};
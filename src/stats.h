@@ -0,0 +1,168 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Статистика контейнеров (по умолчанию выключена): -DLAB3_STATS=1 включает
+// счётчики на горячих путях, при LAB3_STATS == 0 все stats_* - пустые inline
+// функции, и компилятор убирает их вместе с аргументами.
+//
+// Счётчики общие для всех экземпляров контейнера одного вида (myvector, slist, ...)
+// и атомарные (relaxed): контейнеры разных потоков пишут в них без гонок.
+// write_stats выводит их в текстовом формате Prometheus для сборщика метрик.
+#ifndef LAB3_STATS
+#define LAB3_STATS 0
+#endif
+
+// Вид контейнера - строка таблицы счётчиков
+enum class container_kind
+{
+    myvector,
+    slist,
+    dlist,
+    rawdlist,
+    ulist,
+    ilist,
+};
+
+constexpr std::size_t container_kind_count = 6;
+
+// Счётчики одного вида контейнеров
+struct container_stats
+{
+    std::atomic<std::uint64_t> reallocations{0};  // перевыделений массива myvector
+    std::atomic<std::uint64_t> bytesMoved{0};     // байт перенесено при перевыделении и сдвигах
+    std::atomic<std::uint64_t> lookups{0};        // поисков позиции по индексу
+    std::atomic<std::uint64_t> nodesTraversed{0}; // узлов пройдено при этих поисках
+    std::atomic<std::uint64_t> allocations{0};    // выделений памяти
+    std::atomic<std::uint64_t> frees{0};          // освобождений
+    std::atomic<std::uint64_t> liveBytes{0};      // занято сейчас
+    std::atomic<std::uint64_t> peakBytes{0};      // максимум liveBytes
+};
+
+// Таблица счётчиков (одна на программу)
+inline container_stats lab3_stats[container_kind_count];
+
+inline container_stats &stats_of(container_kind kind)
+{
+    return lab3_stats[static_cast<std::size_t>(kind)];
+}
+
+// Выделено bytes байт
+inline void stats_alloc(container_kind kind, std::size_t bytes)
+{
+#if LAB3_STATS
+    container_stats &stats = stats_of(kind);
+    stats.allocations.fetch_add(1, std::memory_order_relaxed);
+    std::uint64_t live = stats.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::uint64_t peak = stats.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !stats.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+#else
+    static_cast<void>(kind);
+    static_cast<void>(bytes);
+#endif
+}
+
+// Освобождено bytes байт
+inline void stats_free(container_kind kind, std::size_t bytes)
+{
+#if LAB3_STATS
+    container_stats &stats = stats_of(kind);
+    stats.frees.fetch_add(1, std::memory_order_relaxed);
+    stats.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+#else
+    static_cast<void>(kind);
+    static_cast<void>(bytes);
+#endif
+}
+
+// Массив перевыделен, перенесено bytes байт элементов
+inline void stats_realloc(container_kind kind, std::size_t bytes)
+{
+#if LAB3_STATS
+    container_stats &stats = stats_of(kind);
+    stats.reallocations.fetch_add(1, std::memory_order_relaxed);
+    stats.bytesMoved.fetch_add(bytes, std::memory_order_relaxed);
+#else
+    static_cast<void>(kind);
+    static_cast<void>(bytes);
+#endif
+}
+
+// Элементы сдвинуты внутри массива (вставка/удаление в середине)
+inline void stats_shift(container_kind kind, std::size_t bytes)
+{
+#if LAB3_STATS
+    stats_of(kind).bytesMoved.fetch_add(bytes, std::memory_order_relaxed);
+#else
+    static_cast<void>(kind);
+    static_cast<void>(bytes);
+#endif
+}
+
+// Поиск позиции по индексу прошёл nodes узлов
+inline void stats_walk(container_kind kind, std::size_t nodes)
+{
+#if LAB3_STATS
+    container_stats &stats = stats_of(kind);
+    stats.lookups.fetch_add(1, std::memory_order_relaxed);
+    stats.nodesTraversed.fetch_add(nodes, std::memory_order_relaxed);
+#else
+    static_cast<void>(kind);
+    static_cast<void>(nodes);
+#endif
+}
+
+// Обнуляет счётчики (кроме liveBytes: занятая память от сброса не меняется)
+inline void reset_stats()
+{
+    for (container_stats &stats : lab3_stats)
+    {
+        stats.reallocations.store(0, std::memory_order_relaxed);
+        stats.bytesMoved.store(0, std::memory_order_relaxed);
+        stats.lookups.store(0, std::memory_order_relaxed);
+        stats.nodesTraversed.store(0, std::memory_order_relaxed);
+        stats.allocations.store(0, std::memory_order_relaxed);
+        stats.frees.store(0, std::memory_order_relaxed);
+        stats.peakBytes.store(stats.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+// Все счётчики в текстовом формате Prometheus:
+//     lab3_allocations_total{container="slist"} 42
+inline void write_stats(std::ostream &out)
+{
+    static const char *const names[container_kind_count] = {"myvector", "slist", "dlist",
+                                                            "rawdlist", "ulist", "ilist"};
+    struct metric
+    {
+        const char *name;
+        const char *type;
+        const char *help;
+        std::atomic<std::uint64_t> container_stats::*field;
+    };
+    static const metric metrics[] = {
+        {"lab3_reallocations_total", "counter", "Array reallocations", &container_stats::reallocations},
+        {"lab3_bytes_moved_total", "counter", "Element bytes moved by reallocation and shifts", &container_stats::bytesMoved},
+        {"lab3_index_lookups_total", "counter", "Positional lookups by index", &container_stats::lookups},
+        {"lab3_nodes_traversed_total", "counter", "Nodes walked by positional lookups", &container_stats::nodesTraversed},
+        {"lab3_allocations_total", "counter", "Memory allocations", &container_stats::allocations},
+        {"lab3_frees_total", "counter", "Memory deallocations", &container_stats::frees},
+        {"lab3_live_bytes", "gauge", "Bytes currently allocated", &container_stats::liveBytes},
+        {"lab3_peak_bytes", "gauge", "Peak bytes allocated", &container_stats::peakBytes},
+    };
+
+    for (const metric &m : metrics)
+    {
+        out << "# HELP " << m.name << ' ' << m.help << '\n';
+        out << "# TYPE " << m.name << ' ' << m.type << '\n';
+        for (std::size_t i = 0; i < container_kind_count; ++i)
+        {
+            out << m.name << "{container=\"" << names[i] << "\"} "
+                << (lab3_stats[i].*m.field).load(std::memory_order_relaxed) << '\n';
+        }
+    }
+}
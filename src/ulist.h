@@ -0,0 +1,803 @@
+#pragma once
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <algorithm>
+#include <initializer_list>
+#include "bounds_check.h"
+#include "write_buffer.h"
+#include "stats.h"
+
+// Ёмкость узла по умолчанию: узел занимает около 256 байт (четыре кэш-линии),
+// но не меньше 4 элементов, иначе развёртка теряет смысл
+template <typename T>
+constexpr std::size_t unrolled_capacity = std::max<std::size_t>(4, 256 / sizeof(T));
+
+// Узел развёрнутого списка: до N элементов подряд в одном массиве.
+// Элементы [0, count) сконструированы, остальная часть массива - сырая память.
+template <typename T, std::size_t N>
+struct UnrolledNode
+{
+    UnrolledNode *next = nullptr; // следующий узел (или nullptr)
+    UnrolledNode *prev = nullptr; // предыдущий узел (или nullptr)
+    std::size_t count = 0;        // сколько элементов занято
+
+    alignas(T) unsigned char storage[sizeof(T) * N];
+
+    // Пользовательский конструктор: иначе value-инициализация обнуляла бы storage
+    UnrolledNode() {}
+
+    T *items() { return reinterpret_cast<T *>(storage); }
+    const T *items() const { return reinterpret_cast<const T *>(storage); }
+};
+
+// Развёрнутый (unrolled) двусвязный список: интерфейс как у dlist/rawdlist, но
+// каждый узел хранит до N элементов подряд. Обход идёт по массиву и переходит
+// по указателю раз в N элементов, operator[] пропускает узлы целиком (с ближнего
+// к индексу конца), а вставка/удаление в середине сдвигают элементы только
+// внутри одного узла. Переполненный узел делится пополам, а узел, опустевший
+// меньше чем наполовину, сливается с соседом, если они помещаются в один.
+//
+// Как и в myvector, вставка и удаление сдвигают элементы узла, поэтому
+// итераторы и ссылки на элементы изменённого узла (и его соседа при делении
+// или слиянии) становятся недействительными.
+template <typename T, std::size_t N = unrolled_capacity<T>, typename Alloc = std::allocator<T>>
+class ulist
+{
+    static_assert(N >= 2, "ulist node must hold at least two elements");
+
+private:
+    using node_type = UnrolledNode<T, N>;
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc; // аллокатор узлов
+    node_type *head;      // первый узел (nullptr если список пуст)
+    node_type *tail;      // последний узел (nullptr если список пуст)
+    std::size_t length;   // общее количество элементов
+
+    // Создаёт пустой узел через аллокатор списка
+    node_type *make_node()
+    {
+        node_type *raw = node_traits::allocate(alloc, 1);
+        node_traits::construct(alloc, raw);
+        stats_alloc(container_kind::ulist, sizeof(node_type));
+        return raw;
+    }
+
+    // Уничтожает элементы узла, сам узел и возвращает память аллокатору
+    void destroy_node(node_type *node)
+    {
+        std::destroy(node->items(), node->items() + node->count);
+        node_traits::destroy(alloc, node);
+        node_traits::deallocate(alloc, node, 1);
+        stats_free(container_kind::ulist, sizeof(node_type));
+    }
+
+    // Забирает узлы другого списка (свой список должен быть пуст)
+    void steal(ulist &list)
+    {
+        head = list.head;
+        tail = list.tail;
+        length = list.length;
+
+        list.head = nullptr;
+        list.tail = nullptr;
+        list.length = 0;
+    }
+
+    // Вставляет пустой узел fresh сразу после node (nullptr - в начало списка)
+    void link_after(node_type *node, node_type *fresh)
+    {
+        fresh->prev = node;
+        fresh->next = node != nullptr ? node->next : head;
+        if (fresh->next != nullptr)
+            fresh->next->prev = fresh;
+        else
+            tail = fresh;
+        if (node != nullptr)
+            node->next = fresh;
+        else
+            head = fresh;
+    }
+
+    // Вырезает узел из списка и уничтожает его
+    void unlink(node_type *node)
+    {
+        if (node->prev != nullptr)
+            node->prev->next = node->next;
+        else
+            head = node->next;
+
+        if (node->next != nullptr)
+            node->next->prev = node->prev;
+        else
+            tail = node->prev;
+
+        destroy_node(node);
+    }
+
+    // Переносит элементы [from, count) узла source в конец узла dest
+    static void move_items(node_type *source, std::size_t from, node_type *dest)
+    {
+        std::uninitialized_move(source->items() + from, source->items() + source->count,
+                                dest->items() + dest->count);
+        std::destroy(source->items() + from, source->items() + source->count);
+        dest->count += source->count - from;
+        source->count = from;
+    }
+
+    // Узел и смещение в нём для элемента с номером index (0 <= index < length).
+    // Узлы пропускаются целиком, обход - с ближнего к index конца.
+    node_type *locate(std::size_t index, std::size_t &offset) const
+    {
+        std::size_t steps = 0; // для статистики
+        if (index < length / 2)
+        {
+            node_type *cur = head;
+            while (index >= cur->count)
+            {
+                index -= cur->count;
+                cur = cur->next;
+                ++steps;
+            }
+            stats_walk(container_kind::ulist, steps);
+            offset = index;
+            return cur;
+        }
+
+        std::size_t fromBack = length - 1 - index;
+        node_type *cur = tail;
+        while (fromBack >= cur->count)
+        {
+            fromBack -= cur->count;
+            cur = cur->prev;
+            ++steps;
+        }
+        stats_walk(container_kind::ulist, steps);
+        offset = cur->count - 1 - fromBack;
+        return cur;
+    }
+
+    // Элемент с номером index (0 <= index < length)
+    T &element(std::size_t index) const
+    {
+        std::size_t offset;
+        node_type *node = locate(index, offset);
+        return node->items()[offset];
+    }
+
+    // Вставка в конец: элемент конструируется прямо в ячейке последнего узла.
+    // Полный хвост не делится - за ним заводится новый узел, так что
+    // последовательное заполнение оставляет узлы заполненными целиком.
+    template <typename... Args>
+    T &construct_back(Args &&...args)
+    {
+        if (tail == nullptr || tail->count == N)
+        {
+            node_type *fresh = make_node();
+            try
+            {
+                new (fresh->items()) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                destroy_node(fresh);
+                throw;
+            }
+            fresh->count = 1;
+            link_after(tail, fresh);
+        }
+        else
+        {
+            new (tail->items() + tail->count) T(std::forward<Args>(args)...);
+            tail->count++;
+        }
+        length++;
+        return tail->items()[tail->count - 1];
+    }
+
+    // Вставка перед элементом offset узла node (offset < node->count: вставка в
+    // конец списка идёт через construct_back).
+    // Возвращает узел и смещение, где оказался новый элемент.
+    template <typename... Args>
+    node_type *insert_at(node_type *node, std::size_t &offset, Args &&...args)
+    {
+        // Значение строится заранее: args могут ссылаться на элементы, которые сейчас сдвинутся
+        T value(std::forward<Args>(args)...);
+
+        if (node->count == N)
+        {
+            if (offset == 0 && node->prev != nullptr && node->prev->count < N)
+            {
+                node = node->prev; // в конец предыдущего, у которого есть место
+                offset = node->count;
+            }
+            else
+            {
+                // Делим полный узел пополам
+                node_type *fresh = make_node();
+                link_after(node, fresh);
+                move_items(node, N / 2, fresh);
+                if (offset > N / 2)
+                {
+                    node = fresh;
+                    offset -= N / 2;
+                }
+            }
+        }
+
+        T *items = node->items();
+        if (offset == node->count)
+        {
+            new (items + offset) T(std::move(value));
+        }
+        else
+        {
+            // Последний элемент узла переезжает в свободную ячейку, остальные сдвигаются вправо
+            new (items + node->count) T(std::move(items[node->count - 1]));
+            std::move_backward(items + offset, items + node->count - 1, items + node->count);
+            items[offset] = std::move(value);
+        }
+        node->count++;
+        length++;
+        return node;
+    }
+
+    // Удаление элемента offset узла node.
+    // Возвращает узел и смещение элемента, следовавшего за удалённым (nullptr - конец).
+    node_type *erase_at(node_type *node, std::size_t &offset)
+    {
+        T *items = node->items();
+        std::move(items + offset + 1, items + node->count, items + offset);
+        items[node->count - 1].~T();
+        node->count--;
+        length--;
+
+        if (node->count == 0)
+        {
+            node_type *next = node->next;
+            unlink(node);
+            offset = 0;
+            return next;
+        }
+
+        if (node->count < N / 2)
+        {
+            if (node->next != nullptr && node->count + node->next->count <= N)
+            {
+                // Сосед справа переезжает в этот узел: номера элементов узла не меняются
+                node_type *next = node->next;
+                move_items(next, 0, node);
+                unlink(next);
+            }
+            else if (node->prev != nullptr && node->prev->count + node->count <= N)
+            {
+                // Этот узел переезжает в конец соседа слева
+                node_type *prev = node->prev;
+                offset += prev->count;
+                move_items(node, 0, prev);
+                unlink(node);
+                node = prev;
+            }
+        }
+
+        if (offset == node->count)
+        {
+            // Удалили последний элемент узла - следующий лежит в начале следующего узла
+            node = node->next;
+            offset = 0;
+        }
+        return node;
+    }
+
+public:
+    // Сколько элементов помещается в один узел
+    static constexpr std::size_t node_capacity = N;
+
+    // Конструктор пустого списка
+    ulist() : ulist(Alloc()) {}
+
+    // Пустой список, узлы которого будут выделяться через allocator
+    explicit ulist(const Alloc &allocator) : alloc(allocator)
+    {
+        head = nullptr;
+        tail = nullptr;
+        length = 0;
+    }
+
+    // Список из списка инициализации
+    ulist(std::initializer_list<T> init, const Alloc &allocator = Alloc()) : ulist(allocator)
+    {
+        append_range(init.begin(), init.end());
+    }
+
+    // Список из диапазона итераторов [first, last)
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    ulist(InputIt first, InputIt last, const Alloc &allocator = Alloc()) : ulist(allocator)
+    {
+        append_range(first, last);
+    }
+
+    // Move-конструктор: "перехватывает" узлы (и аллокатор) из другого списка
+    ulist(ulist &&list) : alloc(std::move(list.alloc))
+    {
+        steal(list);
+    }
+
+    // Деструктор: список - единственный владелец, поэтому удаляет узлы сам
+    ~ulist()
+    {
+        clear();
+    }
+
+    // Аллокатор, которым список выделяет узлы
+    Alloc get_allocator() const
+    {
+        return Alloc(alloc);
+    }
+
+    // Удаляет все элементы
+    void clear()
+    {
+        node_type *cur = head;
+        while (cur != nullptr)
+        {
+            node_type *next = cur->next;
+            destroy_node(cur);
+            cur = next;
+        }
+        head = nullptr;
+        tail = nullptr;
+        length = 0;
+    }
+
+    // Вставка в конец: версия для lvalue (копирование)
+    void push_back(T &value)
+    {
+        construct_back(value);
+    }
+
+    // Вставка в конец: версия для rvalue (перемещение)
+    void push_back(T &&value)
+    {
+        construct_back(std::move(value));
+    }
+
+    // Вставка в конец: элемент конструируется прямо в ячейке узла из args
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        return construct_back(std::forward<Args>(args)...);
+    }
+
+    // Вставка в начало: элемент конструируется из args
+    template <typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return emplace(0, std::forward<Args>(args)...);
+    }
+
+    // Вставка в начало: версия для lvalue (копирование)
+    void push_front(T &value)
+    {
+        insert(value, 0);
+    }
+
+    // Вставка в начало: версия для rvalue (перемещение)
+    void push_front(T &&value)
+    {
+        insert(std::move(value), 0);
+    }
+
+    // Удаление первого элемента
+    void pop_front()
+    {
+        if (head == nullptr)
+            throw std::out_of_range("List is empty");
+        erase(0);
+    }
+
+    // Первый элемент за O(1). Пустой список проверяется только при LAB3_BOUNDS_CHECK
+    T &front()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->items()[0];
+    }
+
+    const T &front() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return head->items()[0];
+    }
+
+    // Последний элемент за O(1)
+    T &back()
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->items()[tail->count - 1];
+    }
+
+    const T &back() const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_not_empty(length == 0, "List is empty");
+        return tail->items()[tail->count - 1];
+    }
+
+    // Простой вывод списка
+    void print() const
+    {
+        print_range(begin(), end());
+    }
+
+    // Вывод элементов через separator: текст копится в буфере и уходит в поток
+    // блоками по write_chunk_size байт, числа форматируются std::to_chars
+    void write_to(std::ostream &out, const char *separator = " ") const
+    {
+        ostream_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    void write_to(std::FILE *out, const char *separator = " ") const
+    {
+        file_sink sink{out};
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Потоковый режим: готовые блоки текста передаются в sink(const char *data, std::size_t size)
+    // по мере заполнения буфера - весь вывод целиком в памяти не собирается
+    template <typename Sink>
+    void write_chunks(Sink &&sink, const char *separator = " ") const
+    {
+        write_range(sink, begin(), end(), separator);
+    }
+
+    // Возвращает текущую длину
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    // Пуст ли список
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    // Доступ по индексу: O(n / N) переходов по узлам.
+    // Границы проверяются только при LAB3_BOUNDS_CHECK
+    T &operator[](std::size_t index)
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return element(index);
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        if (LAB3_BOUNDS_CHECK)
+            check_index(index, length);
+        return element(index);
+    }
+
+    // Доступ по индексу с проверкой границ в любой сборке
+    T &at(std::size_t index)
+    {
+        check_index(index, length);
+        return element(index);
+    }
+
+    const T &at(std::size_t index) const
+    {
+        check_index(index, length);
+        return element(index);
+    }
+
+    // Вставка в произвольную позицию: элемент конструируется из args.
+    // Возвращает ссылку на вставленный элемент.
+    template <typename... Args>
+    T &emplace(std::size_t position, Args &&...args)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+        if (position == length)
+            return construct_back(std::forward<Args>(args)...);
+
+        std::size_t offset;
+        node_type *node = locate(position, offset);
+        node = insert_at(node, offset, std::forward<Args>(args)...);
+        return node->items()[offset];
+    }
+
+    // Вставка в произвольную позицию: перемещение
+    void insert(T &&value, std::size_t position)
+    {
+        emplace(position, std::move(value));
+    }
+
+    // Вставка в произвольную позицию: копирование
+    void insert(T &value, std::size_t position)
+    {
+        emplace(position, value);
+    }
+
+    // Удаление по индексу
+    void erase(std::size_t position)
+    {
+        if (position >= length)
+            throw std::out_of_range("Index out of range");
+
+        std::size_t offset;
+        node_type *node = locate(position, offset);
+        erase_at(node, offset);
+    }
+
+    // Move-присваивание
+    ulist &operator=(ulist &&list)
+    {
+        if (this == &list)
+            return *this;
+
+        clear();
+
+        if constexpr (node_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc = list.alloc; // аллокатор уходит вместе с узлами
+        }
+        else if (!(alloc == list.alloc))
+        {
+            // Узлы другого аллокатора освобождать нельзя - перемещаем значения в свои узлы
+            for (T &value : list)
+            {
+                construct_back(std::move(value));
+            }
+            list.clear();
+            return *this;
+        }
+
+        steal(list);
+        return *this;
+    }
+
+    // Copy-присваивание: создаёт копию поэлементно
+    ulist &operator=(ulist &list)
+    {
+        if (this == &list)
+            return *this;
+
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value)
+        {
+            alloc = list.alloc;
+        }
+
+        for (T &value : list)
+        {
+            construct_back(value);
+        }
+        return *this;
+    }
+
+    // Двунаправленный итератор: узел, смещение в нём и список-владелец (end() - это
+    // nullptr, и шаг назад от него должен попасть в последний элемент tail).
+    // IsConst = true - только для чтения.
+    template <bool IsConst>
+    class BasicIterator
+    {
+        using node = std::conditional_t<IsConst, const node_type, node_type>;
+
+        node *ptr;          // текущий узел (nullptr - конец)
+        std::size_t offset; // номер элемента в узле
+        const ulist *owner; // список, по которому идём
+
+        template <bool>
+        friend class BasicIterator;
+        friend class ulist;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T, T> *;
+        using reference = std::conditional_t<IsConst, const T, T> &;
+
+        BasicIterator() : ptr(nullptr), offset(0), owner(nullptr) {}
+        BasicIterator(node *p, std::size_t off, const ulist *list) : ptr(p), offset(off), owner(list) {}
+
+        // Неконстантный итератор неявно превращается в константный
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst> &other) : ptr(other.ptr), offset(other.offset), owner(other.owner) {}
+
+        reference operator*() const { return ptr->items()[offset]; }
+        pointer operator->() const { return ptr->items() + offset; }
+        reference get() const { return ptr->items()[offset]; }
+
+        // Префиксный инкремент: следующий элемент узла, а после последнего - начало следующего узла
+        BasicIterator &operator++()
+        {
+            if (ptr != nullptr && ++offset == ptr->count)
+            {
+                ptr = ptr->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int)
+        {
+            BasicIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        // Префиксный декремент: предыдущий элемент (от end() - к последнему)
+        BasicIterator &operator--()
+        {
+            if (ptr == nullptr || offset == 0)
+            {
+                ptr = ptr == nullptr ? owner->tail : ptr->prev;
+                offset = ptr->count;
+            }
+            --offset;
+            return *this;
+        }
+
+        BasicIterator operator--(int)
+        {
+            BasicIterator old = *this;
+            --*this;
+            return old;
+        }
+
+        friend bool operator==(const BasicIterator &a, const BasicIterator &b)
+        {
+            return a.ptr == b.ptr && a.offset == b.offset;
+        }
+        friend bool operator!=(const BasicIterator &a, const BasicIterator &b) { return !(a == b); }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // Типы в стиле стандартной библиотеки
+    using value_type = T;
+    using allocator_type = Alloc;
+    using reference = T &;
+    using const_reference = const T &;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    // Начало итерации
+    Iterator begin() { return Iterator(head, 0, this); }
+    // Конец итерации (nullptr)
+    Iterator end() { return Iterator(nullptr, 0, this); }
+
+    ConstIterator begin() const { return ConstIterator(head, 0, this); }
+    ConstIterator end() const { return ConstIterator(nullptr, 0, this); }
+    ConstIterator cbegin() const { return ConstIterator(head, 0, this); }
+    ConstIterator cend() const { return ConstIterator(nullptr, 0, this); }
+
+    // Обратный обход
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+    // Заменяет содержимое элементами [first, last).
+    // Новые узлы строятся целиком до того, как старые будут удалены.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last)
+    {
+        ulist chain(first, last, get_allocator());
+        clear();
+        steal(chain);
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    // Добавление элементов [first, last) в конец
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            construct_back(*first);
+        }
+    }
+
+    // Добавление в конец всех элементов диапазона (контейнера, initializer_list и т.п.)
+    template <typename Range>
+    void append_range(const Range &range)
+    {
+        using std::begin;
+        using std::end;
+        append_range(begin(range), end(range));
+    }
+
+    // Вставка элементов [first, last) перед позицией position:
+    // один поиск позиции, дальше каждая вставка идёт от предыдущей
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert_range(std::size_t position, InputIt first, InputIt last)
+    {
+        if (position > length)
+            throw std::out_of_range("Index out of range");
+
+        ConstIterator pos = cend();
+        if (position < length)
+        {
+            std::size_t offset;
+            node_type *node = locate(position, offset);
+            pos = ConstIterator(node, offset, this);
+        }
+        for (; first != last; ++first)
+        {
+            pos = emplace(pos, *first);
+            ++pos;
+        }
+    }
+
+    // Вставка перед позицией pos: перемещение.
+    // Возвращает итератор на вставленный элемент.
+    Iterator insert(ConstIterator pos, T &&value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    // Вставка перед позицией pos: копирование
+    Iterator insert(ConstIterator pos, T &value)
+    {
+        return emplace(pos, value);
+    }
+
+    // Вставка перед позицией pos: элемент конструируется из args
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args &&...args)
+    {
+        if (pos.ptr == nullptr)
+        {
+            construct_back(std::forward<Args>(args)...);
+            return Iterator(tail, tail->count - 1, this);
+        }
+
+        std::size_t offset = pos.offset;
+        node_type *node = insert_at(const_cast<node_type *>(pos.ptr), offset, std::forward<Args>(args)...);
+        return Iterator(node, offset, this);
+    }
+
+    // Удаление элемента в позиции pos.
+    // Возвращает итератор на элемент после удалённого.
+    Iterator erase(ConstIterator pos)
+    {
+        if (pos.ptr == nullptr)
+            throw std::out_of_range("Iterator out of range");
+
+        std::size_t offset = pos.offset;
+        node_type *node = erase_at(const_cast<node_type *>(pos.ptr), offset);
+        return Iterator(node, offset, this);
+    }
+};
+
+// Список с узлами из std::pmr::memory_resource (см. pmr::myvector)
+namespace pmr
+{
+    template <typename T, std::size_t N = unrolled_capacity<T>>
+    using ulist = ::ulist<T, N, std::pmr::polymorphic_allocator<T>>;
+}
@@ -0,0 +1,198 @@
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Буферизованный вывод контейнеров: текст элементов собирается в локальном
+// буфере и уходит в приёмник блоками по write_chunk_size байт - один вызов
+// write/fwrite на блок вместо операции потока на каждый элемент. Числа
+// форматируются std::to_chars (без локали и без виртуальных вызовов потока;
+// вещественные - кратчайшей записью, которая читается обратно без потерь).
+// print() печатает так же, как std::cout << x, см. print_range.
+
+// Размер блока вывода
+constexpr std::size_t write_chunk_size = 64 * 1024;
+
+// Приёмник блоков: std::ostream
+struct ostream_sink
+{
+    std::ostream &out;
+
+    void operator()(const char *data, std::size_t size)
+    {
+        out.write(data, static_cast<std::streamsize>(size));
+    }
+};
+
+// Приёмник блоков: FILE*
+struct file_sink
+{
+    std::FILE *out;
+
+    void operator()(const char *data, std::size_t size)
+    {
+        std::fwrite(data, 1, size, out);
+    }
+};
+
+// Буфер на write_chunk_size байт перед приёмником sink(const char *data, std::size_t size).
+// Заполненный буфер сбрасывается в sink целиком; остаток - вызовом flush()
+template <typename Sink>
+class chunk_writer
+{
+private:
+    // Запас под одно число: самая длинная запись long double короче
+    static constexpr std::size_t numberBytes = 128;
+
+    Sink &sink;
+    std::size_t used = 0;
+    char buffer[write_chunk_size];
+
+public:
+    explicit chunk_writer(Sink &out) : sink(out) {}
+
+    chunk_writer(const chunk_writer &) = delete;
+    chunk_writer &operator=(const chunk_writer &) = delete;
+
+    // Отдаёт накопленное в приёмник
+    void flush()
+    {
+        if (used > 0)
+        {
+            sink(buffer, used);
+            used = 0;
+        }
+    }
+
+    void put(char c)
+    {
+        if (used == write_chunk_size)
+            flush();
+        buffer[used++] = c;
+    }
+
+    // Строка длиннее буфера уходит в приёмник напрямую, без копирования
+    void put(const char *text, std::size_t size)
+    {
+        if (size > write_chunk_size - used)
+        {
+            flush();
+            if (size >= write_chunk_size)
+            {
+                sink(text, size);
+                return;
+            }
+        }
+        std::memcpy(buffer + used, text, size);
+        used += size;
+    }
+
+    // Текстовое представление значения - то же, что даёт operator<<
+    // (кроме вещественных: там кратчайшая точная запись вместо 6 знаков)
+    template <typename T>
+    void put_value(const T &value)
+    {
+        if constexpr (std::is_same<T, bool>::value)
+        {
+            put(value ? '1' : '0');
+        }
+        else if constexpr (std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                           std::is_same<T, unsigned char>::value)
+        {
+            put(static_cast<char>(value));
+        }
+        else if constexpr (std::is_arithmetic<T>::value)
+        {
+            if (write_chunk_size - used < numberBytes)
+                flush();
+            std::to_chars_result result = std::to_chars(buffer + used, buffer + write_chunk_size, value);
+            used = static_cast<std::size_t>(result.ptr - buffer);
+        }
+        else if constexpr (std::is_convertible<const T &, std::string_view>::value)
+        {
+            std::string_view text = value;
+            put(text.data(), text.size());
+        }
+        else
+        {
+            // Прочие типы - через их operator<< во временный поток потока-вызывающего
+            thread_local std::ostringstream scratch;
+            scratch.str(std::string());
+            scratch.clear();
+            scratch << value;
+            const std::string &text = scratch.str();
+            put(text.data(), text.size());
+        }
+    }
+};
+
+// Пишет элементы [first, last) через separator в sink блоками по write_chunk_size
+template <typename Sink, typename It>
+void write_range(Sink &sink, It first, It last, const char *separator)
+{
+    chunk_writer<Sink> writer(sink);
+    const std::size_t separatorLength = std::strlen(separator);
+    for (bool leading = true; first != last; ++first, leading = false)
+    {
+        if (!leading)
+            writer.put(separator, separatorLength);
+        writer.put_value(*first);
+    }
+    writer.flush();
+}
+
+// Поток в формате по умолчанию: десятичные числа без флагов, ширины и локали.
+// Тогда to_chars даёт для целых ровно то же, что operator<<
+inline bool default_number_format(const std::ostream &out)
+{
+    return out.flags() == (std::ios_base::dec | std::ios_base::skipws) && out.width() == 0 &&
+           out.getloc() == std::locale::classic();
+}
+
+// Формат print(): каждый элемент с пробелом после него, в конце перевод строки.
+// Текст тот же, что у std::cout << x: вещественные (и целые, если у std::cout
+// заданы флаги или локаль) форматируются operator<< с флагами, точностью и
+// локалью std::cout - 6 значащих цифр по умолчанию, а не кратчайшая запись
+template <typename It>
+void print_range(It first, It last)
+{
+    using value_type = typename std::decay<decltype(*first)>::type;
+    ostream_sink sink{std::cout};
+    chunk_writer<ostream_sink> writer(sink);
+    if constexpr (std::is_arithmetic<value_type>::value && !std::is_same<value_type, char>::value &&
+                  !std::is_same<value_type, signed char>::value &&
+                  !std::is_same<value_type, unsigned char>::value)
+    {
+        if (std::is_floating_point<value_type>::value || !default_number_format(std::cout))
+        {
+            std::ostringstream scratch;
+            scratch.copyfmt(std::cout);
+            for (; first != last; ++first)
+            {
+                scratch.str(std::string());
+                scratch << *first;
+                const std::string &text = scratch.str();
+                writer.put(text.data(), text.size());
+                writer.put(' ');
+            }
+            std::cout.width(0); // как после std::cout << x: ширина действует на одно значение
+            writer.put('\n');
+            writer.flush();
+            return;
+        }
+    }
+    for (; first != last; ++first)
+    {
+        writer.put_value(*first);
+        writer.put(' ');
+    }
+    writer.put('\n');
+    writer.flush();
+}